@@ -11,5 +11,10 @@
 #include "range.hpp"
 #include "config.hpp"
 #include "mixin.hpp"
+#include "small_vector.hpp"
+#include "source_buffer.hpp"
+#include "interner.hpp"
+#include "source_manager.hpp"
+#include "thread_pool.hpp"
 
 #endif // TLC_CORE_HPP
@@ -4,6 +4,11 @@
 #include "type.hpp"
 #include "singleton.hpp"
 #include "utility.hpp"
+#include "source_manager.hpp"
+#include "range.hpp"
+
+#include <mutex>
+#include <numeric>
 
 namespace tlc {
     class Exception : public std::runtime_error {
@@ -53,31 +58,29 @@ namespace tlc {
         } {}
     };
 
-    // todo: code should be a reference
+    // the file, line and code of {location} are pulled from the SourceManager
     struct CompileException final : Exception {
+        CompileException(SourceLocation const location, Str message)
+            : CompileException{
+                  SourceManager::instance().location(location), location,
+                  std::move(message)
+              } {}
+
+    private:
         CompileException(
-            fs::path filepath, u64 const line, u64 const column,
-            Str message, Str code
+            Location const presumed, SourceLocation const location, Str message
         ): Exception{
-            std::move(filepath), line, column, std::move(message) + "\n"
-            + std::move(code)
+            SourceManager::instance().path(location.file),
+            presumed.line, presumed.column, std::move(message) + "\n" +
+            Str{SourceManager::instance().snippet(location)}
         } {}
     };
 
-#define TLC_CORE_GENERATE_SINGLETON_BODY_PREFIX(className) \
-    public: \
-        static auto instance() -> className& { \
-            return Singleton::instance<className>(); \
-        } \
-    protected: \
-        className() = default;
-
     template <typename EContext, typename EReason>
     class Error final {
     public:
         struct Params final {
-            fs::path filepath;
-            Location location;
+            SourceLocation location;
             EContext context;
             EReason reason;
             Str info;
@@ -87,20 +90,11 @@ namespace tlc {
         explicit Error(Params params) : m_params{std::move(params)} {}
 
         explicit operator CompileException() const {
-            return {
-                m_params.filepath,
-                m_params.location.line,
-                m_params.location.column,
-                message(), ""
-            };
-        }
-
-        auto filepath() const noexcept -> fs::path const& {
-            return m_params.filepath;
+            return {m_params.location, message()};
         }
 
-        auto filepath(fs::path fp) {
-            return m_params.filepath = std::move(fp);
+        [[nodiscard]] auto filepath() const -> fs::path const& {
+            return SourceManager::instance().path(m_params.location.file);
         }
 
         [[nodiscard]] auto context() const -> EContext {
@@ -111,47 +105,236 @@ namespace tlc {
             return m_params.reason;
         }
 
-        [[nodiscard]] auto location() const -> Location {
+        [[nodiscard]] auto location() const -> SourceLocation {
             return m_params.location;
         }
 
+        [[nodiscard]] auto info() const -> StrV {
+            return m_params.info;
+        }
+
         [[nodiscard]] auto message() const -> Str;
 
     private:
         Params m_params{};
     };
 
+    /**
+     * Errors in the order they were collected, owned by a single thread.
+     * Each error is tagged with the unit the thread was compiling when it
+     * was collected.
+     */
     template <typename EContext, typename EReason>
-    class ErrorCollector : public Singleton {
-        TLC_CORE_GENERATE_SINGLETON_BODY_PREFIX(ErrorCollector)
-
+    class ErrorSink final {
     public:
-        auto collect(typename Error<EContext, EReason>::Params errorParams)
-            -> ErrorCollector& {
-            m_collected.emplace_back(errorParams);
+        using TError = Error<EContext, EReason>;
+
+        // errors collected from now on belong to {unit}
+        auto enter(u32 const unit) noexcept -> void {
+            m_unit = unit;
+        }
+
+        auto collect(typename TError::Params errorParams) -> ErrorSink& {
+            m_collected.emplace_back(std::move(errorParams));
+            m_units.push_back(m_unit);
             return *this;
         }
 
-        auto collect(Error<EContext, EReason> error)
-            -> ErrorCollector& {
+        auto collect(TError error) -> ErrorSink& {
             m_collected.push_back(std::move(error));
+            m_units.push_back(m_unit);
             return *this;
         }
 
-        [[nodiscard]] auto size() const -> szt {
+        [[nodiscard]] auto size() const noexcept -> szt {
             return m_collected.size();
         }
 
-        [[nodiscard]] auto empty() const -> szt {
+        [[nodiscard]] auto empty() const noexcept -> b8 {
             return m_collected.empty();
         }
 
-        [[nodiscard]] auto errors() -> auto {
+        // errors collected after the first {count} ones
+        [[nodiscard]] auto since(szt const count) const -> Span<TError const> {
+            return Span<TError const>{m_collected}.subspan(count);
+        }
+
+        [[nodiscard]] auto errors() -> Vec<TError> {
+            m_units.clear();
             return std::exchange(m_collected, {});
         }
 
+        // drains the errors along with their units
+        [[nodiscard]] auto units() -> Vec<Pair<u32, TError>> {
+            Vec<Pair<u32, TError>> tagged;
+            tagged.reserve(m_collected.size());
+            for (szt i = 0; i < m_collected.size(); ++i) {
+                tagged.emplace_back(m_units[i], std::move(m_collected[i]));
+            }
+            m_units.clear();
+            m_collected.clear();
+            return tagged;
+        }
+
+    private:
+        Vec<TError> m_collected;
+        // parallel to m_collected
+        Vec<u32> m_units;
+        u32 m_unit{};
+    };
+
+    /**
+     * Process-wide error collector. Each thread collects into an ErrorSink
+     * of its own, so collecting never locks; a thread only takes the lock to
+     * register its sink on its first error or query, and to unregister it
+     * when it exits. collect() and the thread*() queries are about the sink
+     * of the calling thread and keep the collection order.
+     *
+     * merged() drains the sinks of all threads ordered by unit first. A
+     * driver that compiles units concurrently numbers them and calls unit()
+     * before compiling each one, so that errors are reported in the same
+     * order whatever the number of threads.
+     */
+    template <typename EContext, typename EReason>
+    class ErrorCollector : public Singleton {
+        TLC_CORE_GENERATE_SINGLETON_BODY_PREFIX(ErrorCollector)
+
+    public:
+        using TError = Error<EContext, EReason>;
+        using TSink = ErrorSink<EContext, EReason>;
+
+        // errors the calling thread collects from now on belong to {index}
+        auto unit(u32 const index) -> void {
+            sink().enter(index);
+        }
+
+        auto collect(typename TError::Params errorParams) -> ErrorCollector& {
+            sink().collect(std::move(errorParams));
+            return *this;
+        }
+
+        auto collect(TError error) -> ErrorCollector& {
+            sink().collect(std::move(error));
+            return *this;
+        }
+
+        [[nodiscard]] auto threadSize() const -> szt {
+            return sink().size();
+        }
+
+        [[nodiscard]] auto threadEmpty() const -> b8 {
+            return sink().empty();
+        }
+
+        // errors the calling thread collected after its first {count} ones
+        [[nodiscard]] auto threadSince(szt const count) const
+            -> Span<TError const> {
+            return sink().since(count);
+        }
+
+        // drains the errors of the calling thread only
+        [[nodiscard]] auto threadErrors() -> Vec<TError> {
+            return sink().errors();
+        }
+
+        /**
+         * Drains the errors of every thread, including the threads that have
+         * exited since, ordered by unit, file path, offset, context, reason
+         * and info. Threads must not collect concurrently.
+         */
+        [[nodiscard]] auto merged() -> Vec<TError> {
+            Vec<Pair<u32, TError>> merged;
+            {
+                std::scoped_lock const lock{m_mutex};
+                merged = m_retired.units();
+                for (auto const& sink : m_sinks) {
+                    merged.append_range(sink->units() | rv::as_rvalue);
+                }
+            }
+
+            // the path lookup locks the SourceManager, so it is done once per
+            // error rather than once per comparison
+            using Key = Tpl<u32, fs::path const&, u32, EContext, EReason, StrV>;
+            Vec<Key> keys;
+            keys.reserve(merged.size());
+            for (auto const& [unit, error] : merged) {
+                keys.emplace_back(
+                    unit, error.filepath(), error.location().offset,
+                    error.context(), error.reason(), error.info()
+                );
+            }
+
+            Vec<szt> order(merged.size());
+            std::iota(order.begin(), order.end(), szt{0});
+            rng::stable_sort(order, [&keys](szt const lhs, szt const rhs) {
+                return keys[lhs] < keys[rhs];
+            });
+
+            Vec<TError> errors;
+            errors.reserve(merged.size());
+            for (auto const i : order) {
+                errors.push_back(std::move(merged[i].second));
+            }
+            return errors;
+        }
+
+    private:
+        // unregisters the sink of a thread when the thread exits
+        class Registration final {
+        public:
+            Registration() = default;
+            Registration(Registration const&) = delete;
+            auto operator=(Registration const&) -> Registration& = delete;
+
+            ~Registration() noexcept {
+                if (m_sink != nullptr) {
+                    m_collector->retire(m_sink);
+                }
+            }
+
+            [[nodiscard]] auto sink() const noexcept -> TSink* {
+                return m_sink;
+            }
+
+            auto set(ErrorCollector const* collector, TSink* sink) noexcept -> void {
+                m_collector = collector;
+                m_sink = sink;
+            }
+
+        private:
+            ErrorCollector const* m_collector{};
+            TSink* m_sink{};
+        };
+
+        auto sink() const -> TSink& {
+            thread_local Registration registration;
+            if (registration.sink() == nullptr) {
+                std::scoped_lock const lock{m_mutex};
+                registration.set(
+                    this, m_sinks.emplace_back(std::make_unique<TSink>()).get()
+                );
+            }
+            return *registration.sink();
+        }
+
+        // keeps the errors of {sink} for merged() and drops the sink
+        auto retire(TSink* const sink) const -> void {
+            std::scoped_lock const lock{m_mutex};
+            for (auto&& [unit, error] : sink->units()) {
+                m_retired.enter(unit);
+                m_retired.collect(std::move(error));
+            }
+            std::erase_if(m_sinks, [sink](Ptr<TSink> const& registered) {
+                return registered.get() == sink;
+            });
+        }
+
     private:
-        Vec<Error<EContext, EReason>> m_collected;
+        mutable std::mutex m_mutex{};
+        // one per thread alive that used the collector
+        mutable Vec<Ptr<TSink>> m_sinks{};
+        // what threads that exited collected and merged() has yet to drain
+        mutable TSink m_retired{};
     };
 }
 
@@ -0,0 +1,91 @@
+#include "interner.hpp"
+#include "range.hpp"
+#include "exception.hpp"
+
+#include <bit>
+
+namespace tlc {
+    Interner::~Interner() noexcept {
+        for (auto& segment : m_segments | rv::drop(1)) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    auto Interner::intern(StrV const str) -> Symbol {
+        if (str.empty()) {
+            return {};
+        }
+
+        Key const key{str, std::hash<StrV>{}(str)};
+        auto& shard = m_shards[key.hash % shardCount];
+
+        {
+            std::shared_lock const lock{shard.mutex};
+            if (auto const it = shard.symbols.find(key);
+                it != shard.symbols.end()) {
+                return Symbol{it->second};
+            }
+        }
+
+        std::unique_lock const lock{shard.mutex};
+        if (auto const it = shard.symbols.find(key);
+            it != shard.symbols.end()) {
+            return Symbol{it->second};
+        }
+
+        auto const id = m_size.fetch_add(1, std::memory_order_acq_rel);
+        if (id == 0) {
+            throw Exception{"Ran out of symbols"};
+        }
+
+        auto const* const data = store(shard, str);
+        publish(id, {data, static_cast<u32>(str.size()), key.hash});
+        shard.symbols.emplace(Key{{data, str.size()}, key.hash}, id);
+        return Symbol{id};
+    }
+
+    auto Interner::at(u32 const id) const noexcept -> Entry const& {
+        auto const position = static_cast<u64>(id) + (u64{1} << firstSegmentBits);
+        auto const segment = std::bit_width(position) - 1 - firstSegmentBits;
+        return m_segments[segment].load(std::memory_order_acquire)
+            [position - (u64{1} << (segment + firstSegmentBits))];
+    }
+
+    auto Interner::store(Shard& shard, StrV const str) -> c8 const* {
+        if (str.size() > chunkSize / 4) {
+            auto& chunk = shard.chunks.emplace_back(
+                std::make_unique_for_overwrite<c8[]>(str.size())
+            );
+            return rng::copy(str, chunk.get()).out - str.size();
+        }
+
+        if (shard.remaining < str.size()) {
+            shard.cursor = shard.chunks.emplace_back(
+                std::make_unique_for_overwrite<c8[]>(chunkSize)
+            ).get();
+            shard.remaining = chunkSize;
+        }
+
+        auto const* const data = shard.cursor;
+        shard.cursor = rng::copy(str, shard.cursor).out;
+        shard.remaining -= str.size();
+        return data;
+    }
+
+    auto Interner::publish(u32 const id, Entry const entry) -> void {
+        auto const position = static_cast<u64>(id) + (u64{1} << firstSegmentBits);
+        auto const segment = std::bit_width(position) - 1 - firstSegmentBits;
+        auto* entries = m_segments[segment].load(std::memory_order_acquire);
+
+        if (!entries) {
+            std::scoped_lock const lock{m_segmentMutex};
+            entries = m_segments[segment].load(std::memory_order_acquire);
+            if (!entries) {
+                entries = new Entry[u64{1} << (segment + firstSegmentBits)];
+                m_segments[segment].store(entries, std::memory_order_release);
+            }
+        }
+
+        entries[position - (u64{1} << (segment + firstSegmentBits))] = entry;
+    }
+}
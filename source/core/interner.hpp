@@ -0,0 +1,141 @@
+#ifndef TLC_CORE_INTERNER_HPP
+#define TLC_CORE_INTERNER_HPP
+
+#include "type.hpp"
+#include "singleton.hpp"
+
+#include <atomic>
+#include <shared_mutex>
+
+namespace tlc {
+    /**
+     * 32-bit handle of an interned string. Two symbols compare equal iff
+     * their strings do, and their hash was computed once when interned. The
+     * default symbol is the empty string.
+     */
+    class Symbol final {
+    public:
+        constexpr Symbol() noexcept = default;
+
+        [[nodiscard]] auto str() const noexcept -> StrV;
+
+        [[nodiscard]] auto hash() const noexcept -> szt;
+
+        [[nodiscard]] constexpr auto id() const noexcept -> u32 {
+            return m_id;
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> b8 {
+            return m_id == 0;
+        }
+
+        constexpr auto operator==(Symbol const&) const noexcept -> bool = default;
+
+    private:
+        friend class Interner;
+
+        explicit constexpr Symbol(u32 const id) noexcept : m_id{id} {}
+
+    private:
+        u32 m_id{};
+    };
+
+    /**
+     * Process-wide string table. Interning takes the lock of one of several
+     * shards picked by the hash of the string, while looking up the string or
+     * hash of a symbol never locks. Interned strings live as long as the
+     * program does.
+     */
+    class Interner : public Singleton {
+        TLC_CORE_GENERATE_SINGLETON_BODY_PREFIX(Interner)
+
+    public:
+        ~Interner() noexcept;
+
+        auto intern(StrV str) -> Symbol;
+
+        [[nodiscard]] auto str(Symbol const symbol) const noexcept -> StrV {
+            auto const& entry = at(symbol.id());
+            return {entry.data, entry.length};
+        }
+
+        [[nodiscard]] auto hash(Symbol const symbol) const noexcept -> szt {
+            return at(symbol.id()).hash;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_size.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct Entry {
+            c8 const* data = "";
+            u32 length{};
+            szt hash = std::hash<StrV>{}({});
+        };
+
+        struct Key {
+            StrV str;
+            szt hash;
+
+            auto operator==(Key const& other) const noexcept -> bool {
+                return hash == other.hash && str == other.str;
+            }
+        };
+
+        struct KeyHash {
+            auto operator()(Key const& key) const noexcept -> szt {
+                return key.hash;
+            }
+        };
+
+        struct Shard {
+            std::shared_mutex mutex;
+            std::unordered_map<Key, u32, KeyHash> symbols;
+            // storage of interned strings, chunks are never reallocated
+            Vec<Ptr<c8[]>> chunks;
+            c8* cursor{};
+            szt remaining{};
+        };
+
+        // segment i holds 2^(i + firstSegmentBits) entries, so that entries
+        // never move once published
+        static constexpr szt firstSegmentBits = 8;
+        static constexpr szt segmentCount = 33 - firstSegmentBits;
+        static constexpr szt shardCount = 16;
+        static constexpr szt chunkSize = 16 * 1024;
+
+        [[nodiscard]] auto at(u32 id) const noexcept -> Entry const&;
+
+        auto store(Shard& shard, StrV str) -> c8 const*;
+
+        auto publish(u32 id, Entry entry) -> void;
+
+    private:
+        Arr<Shard, shardCount> m_shards{};
+        // the first segment is inline so that the empty symbol always exists
+        Arr<Entry, szt{1} << firstSegmentBits> m_firstSegment{};
+        Arr<std::atomic<Entry*>, segmentCount> m_segments{
+            m_firstSegment.data()
+        };
+        std::mutex m_segmentMutex{};
+        std::atomic<u32> m_size = 1;
+    };
+
+    inline auto Symbol::str() const noexcept -> StrV {
+        return Interner::instance().str(*this);
+    }
+
+    inline auto Symbol::hash() const noexcept -> szt {
+        return Interner::instance().hash(*this);
+    }
+}
+
+template <>
+struct std::hash<tlc::Symbol> {
+    auto operator()(tlc::Symbol const symbol) const noexcept -> tlc::szt {
+        return symbol.hash();
+    }
+};
+
+#endif // TLC_CORE_INTERNER_HPP
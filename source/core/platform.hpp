@@ -1,4 +1,10 @@
 #ifndef TLC_CORE_PLATFORM_HPP
 #define TLC_CORE_PLATFORM_HPP
 
+#if defined(_WIN32)
+#define TLC_PLATFORM_WINDOWS
+#elif defined(__unix__) || defined(__APPLE__)
+#define TLC_PLATFORM_POSIX
+#endif
+
 #endif // TLC_CORE_PLATFORM_HPP
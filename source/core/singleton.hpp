@@ -6,6 +6,14 @@
 
 #include <mutex>
 
+#define TLC_CORE_GENERATE_SINGLETON_BODY_PREFIX(className) \
+    public: \
+        static auto instance() -> className& { \
+            return Singleton::instance<className>(); \
+        } \
+    protected: \
+        className() = default;
+
 namespace tlc {
     template <typename T>
     concept IsSingleton =
@@ -28,11 +36,10 @@ namespace tlc {
             static std::once_flag onceFlag;
             static Ptr<T> ptr;
 
-            if (!ptr) {
-                std::call_once(onceFlag, [&]() -> void {
-                    ptr = std::make_unique<Instance>();
-                });
-            }
+            // checking ptr first would race with the thread initializing it
+            std::call_once(onceFlag, [&]() -> void {
+                ptr = std::make_unique<Instance>();
+            });
             return *ptr;
         }
 
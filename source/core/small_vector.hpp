@@ -0,0 +1,164 @@
+#ifndef TLC_CORE_SMALL_VECTOR_HPP
+#define TLC_CORE_SMALL_VECTOR_HPP
+
+#include "type.hpp"
+
+#include <algorithm>
+
+namespace tlc {
+    /**
+     * Vector of trivially copyable elements that keeps up to {N} of them
+     * inline and only allocates once it grows past that. Meant for short
+     * lists that are almost always tiny, such as the segments of a path.
+     *
+     * A recursive type cannot be stored inline in itself, which is why the
+     * children of syntax nodes still live in a Vec.
+     */
+    template <typename T, szt N>
+        requires std::is_trivially_copyable_v<T> && (N > 0)
+    class SmallVec final {
+    public:
+        using value_type = T;
+        using size_type = szt;
+        using iterator = T*;
+        using const_iterator = T const*;
+
+        SmallVec() noexcept = default;
+
+        SmallVec(std::initializer_list<T> const values) {
+            append(values);
+        }
+
+        explicit SmallVec(Span<T const> const values) {
+            append(values);
+        }
+
+        SmallVec(SmallVec const& other) {
+            append(other);
+        }
+
+        SmallVec(SmallVec&& other) noexcept
+            : m_inline{other.m_inline}, m_heap{std::move(other.m_heap)},
+              m_size{std::exchange(other.m_size, 0)},
+              m_capacity{std::exchange(other.m_capacity, N)} {}
+
+        ~SmallVec() noexcept = default;
+
+        auto operator=(SmallVec const& other) -> SmallVec& {
+            if (this != &other) {
+                clear();
+                append(other);
+            }
+            return *this;
+        }
+
+        auto operator=(SmallVec&& other) noexcept -> SmallVec& {
+            if (this != &other) {
+                m_inline = other.m_inline;
+                m_heap = std::move(other.m_heap);
+                m_size = std::exchange(other.m_size, 0);
+                m_capacity = std::exchange(other.m_capacity, N);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_size;
+        }
+
+        [[nodiscard]] auto capacity() const noexcept -> szt {
+            return m_capacity;
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> b8 {
+            return m_size == 0;
+        }
+
+        // true as long as the elements are stored inline
+        [[nodiscard]] auto inlined() const noexcept -> b8 {
+            return m_heap == nullptr;
+        }
+
+        [[nodiscard]] auto data() noexcept -> T* {
+            return inlined() ? m_inline.data() : m_heap.get();
+        }
+
+        [[nodiscard]] auto data() const noexcept -> T const* {
+            return inlined() ? m_inline.data() : m_heap.get();
+        }
+
+        [[nodiscard]] auto begin() noexcept -> iterator {
+            return data();
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator {
+            return data();
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator {
+            return data() + m_size;
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator {
+            return data() + m_size;
+        }
+
+        [[nodiscard]] auto operator[](szt const index) noexcept -> T& {
+            return data()[index];
+        }
+
+        [[nodiscard]] auto operator[](szt const index) const noexcept -> T const& {
+            return data()[index];
+        }
+
+        [[nodiscard]] auto front() const noexcept -> T const& {
+            return data()[0];
+        }
+
+        [[nodiscard]] auto back() const noexcept -> T const& {
+            return data()[m_size - 1];
+        }
+
+        auto reserve(szt const capacity) -> void {
+            if (capacity <= m_capacity) {
+                return;
+            }
+
+            auto const grown = std::max(capacity, 2 * m_capacity);
+            auto heap = std::make_unique_for_overwrite<T[]>(grown);
+            std::copy_n(data(), m_size, heap.get());
+            m_heap = std::move(heap);
+            m_capacity = grown;
+        }
+
+        auto push_back(T const value) -> void {
+            if (m_size == m_capacity) {
+                reserve(m_size + 1);
+            }
+            data()[m_size++] = value;
+        }
+
+        auto append(Span<T const> const values) -> void {
+            reserve(m_size + values.size());
+            std::ranges::copy(values, data() + m_size);
+            m_size += values.size();
+        }
+
+        // keeps the capacity, like Vec::clear
+        auto clear() noexcept -> void {
+            m_size = 0;
+        }
+
+        [[nodiscard]] auto operator==(SmallVec const& other) const noexcept -> bool {
+            return std::ranges::equal(*this, other);
+        }
+
+    private:
+        Arr<T, N> m_inline{};
+        Ptr<T[]> m_heap{};
+        szt m_size{};
+        szt m_capacity{N};
+    };
+}
+
+#endif // TLC_CORE_SMALL_VECTOR_HPP
@@ -0,0 +1,93 @@
+#include "source_buffer.hpp"
+#include "exception.hpp"
+#include "platform.hpp"
+
+#include <fstream>
+
+#ifdef TLC_PLATFORM_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tlc {
+    SourceBuffer::SourceBuffer(fs::path const& filepath) {
+#ifdef TLC_PLATFORM_POSIX
+        auto const fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw Exception{filepath, "Failed to open " + filepath.string()};
+        }
+
+        struct stat status{};
+        if (::fstat(fd, &status) == 0 && status.st_size > 0) {
+            auto const size = static_cast<szt>(status.st_size);
+            if (auto* const region = ::mmap(
+                    nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0
+                ); region != MAP_FAILED) {
+                ::madvise(region, size, MADV_SEQUENTIAL);
+                ::close(fd);
+                m_data = static_cast<c8 const*>(region);
+                m_size = size;
+                m_mapped = true;
+                return;
+            }
+        }
+        ::close(fd);
+#endif
+
+        // fallback: read the whole file with a single call
+        std::ifstream ifs{filepath, std::ios::binary | std::ios::ate};
+        if (!ifs.is_open()) {
+            throw Exception{filepath, "Failed to open " + filepath.string()};
+        }
+
+        m_owned.resize(static_cast<szt>(ifs.tellg()));
+        ifs.seekg(0);
+        ifs.read(m_owned.data(), static_cast<std::streamsize>(m_owned.size()));
+        m_data = m_owned.data();
+        m_size = m_owned.size();
+    }
+
+    SourceBuffer::SourceBuffer(SourceBuffer&& other) noexcept
+        : m_owned{std::move(other.m_owned)},
+          m_data{other.m_mapped ? other.m_data : m_owned.data()},
+          m_size{other.m_size}, m_mapped{other.m_mapped} {
+        other.m_mapped = false;
+        other.m_data = other.m_owned.data();
+        other.m_size = 0;
+    }
+
+    SourceBuffer::~SourceBuffer() noexcept {
+        release();
+    }
+
+    auto SourceBuffer::operator=(SourceBuffer&& other) noexcept
+        -> SourceBuffer& {
+        if (this == &other) {
+            return *this;
+        }
+
+        release();
+        m_owned = std::move(other.m_owned);
+        m_data = other.m_mapped ? other.m_data : m_owned.data();
+        m_size = other.m_size;
+        m_mapped = other.m_mapped;
+
+        other.m_mapped = false;
+        other.m_data = other.m_owned.data();
+        other.m_size = 0;
+        return *this;
+    }
+
+    auto SourceBuffer::release() noexcept -> void {
+#ifdef TLC_PLATFORM_POSIX
+        if (m_mapped) {
+            ::munmap(const_cast<c8*>(m_data), m_size);
+        }
+#endif
+        m_mapped = false;
+        m_data = m_owned.data();
+        m_size = 0;
+    }
+}
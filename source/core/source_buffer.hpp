@@ -0,0 +1,61 @@
+#ifndef TLC_CORE_SOURCE_BUFFER_HPP
+#define TLC_CORE_SOURCE_BUFFER_HPP
+
+#include "type.hpp"
+#include "utility.hpp"
+
+namespace tlc {
+    /**
+     * Contiguous, read-only storage for a whole source file. Files are
+     * memory-mapped where the platform supports it and read with a single
+     * call otherwise. In-memory sources take over the storage of the given
+     * string instead of copying it.
+     */
+    class SourceBuffer final {
+    public:
+        SourceBuffer() = default;
+
+        explicit SourceBuffer(fs::path const& filepath);
+
+        explicit SourceBuffer(Str source) noexcept
+            : m_owned{std::move(source)},
+              m_data{m_owned.data()}, m_size{m_owned.size()} {}
+
+        explicit SourceBuffer(std::istringstream iss)
+            : SourceBuffer{std::move(iss).str()} {}
+
+        SourceBuffer(SourceBuffer&& other) noexcept;
+        SourceBuffer(SourceBuffer const&) = delete;
+        ~SourceBuffer() noexcept;
+
+        auto operator=(SourceBuffer&& other) noexcept -> SourceBuffer&;
+        auto operator=(SourceBuffer const&) -> SourceBuffer& = delete;
+
+        [[nodiscard]] auto data() const noexcept -> c8 const* {
+            return m_data;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_size;
+        }
+
+        [[nodiscard]] auto view() const noexcept -> StrV {
+            return {m_data, m_size};
+        }
+
+        [[nodiscard]] auto mapped() const noexcept -> b8 {
+            return m_mapped;
+        }
+
+    private:
+        auto release() noexcept -> void;
+
+    private:
+        Str m_owned{};
+        c8 const* m_data = m_owned.data();
+        szt m_size = 0;
+        b8 m_mapped = false;
+    };
+}
+
+#endif // TLC_CORE_SOURCE_BUFFER_HPP
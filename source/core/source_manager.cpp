@@ -0,0 +1,119 @@
+#include "source_manager.hpp"
+#include "exception.hpp"
+#include "range.hpp"
+
+namespace tlc {
+    namespace {
+        auto lineStartsOf(StrV const text) -> Vec<u32> {
+            Vec<u32> starts{0};
+            // single character finds are memchr calls, which are vectorized
+            for (auto newline = text.find('\n'); newline != StrV::npos;
+                 newline = text.find('\n', newline + 1)) {
+                starts.push_back(static_cast<u32>(newline + 1));
+            }
+            return starts;
+        }
+
+        auto textOf(SPtr<SourceBuffer const> const& buffer) -> StrV {
+            return buffer ? buffer->view() : StrV{};
+        }
+    }
+
+    auto SourceManager::load(fs::path const& filepath) -> FileID {
+        auto key = fs::weakly_canonical(filepath).string();
+
+        {
+            std::shared_lock const lock{m_mutex};
+            if (auto const it = m_loaded.find(key); it != m_loaded.end()) {
+                return it->second;
+            }
+        }
+
+        // read outside the lock, another thread loading the same file wins
+        auto buffer = std::make_shared<SourceBuffer const>(filepath);
+
+        {
+            std::shared_lock const lock{m_mutex};
+            if (auto const it = m_loaded.find(key); it != m_loaded.end()) {
+                return it->second;
+            }
+        }
+
+        auto const id = add(std::move(buffer), filepath);
+        std::unique_lock const lock{m_mutex};
+        return m_loaded.try_emplace(std::move(key), id).first->second;
+    }
+
+    auto SourceManager::add(SPtr<SourceBuffer const> buffer, fs::path filepath)
+        -> FileID {
+        if (buffer && buffer->size() > std::numeric_limits<u32>::max()) {
+            throw Exception{
+                filepath, "Sources larger than 4GiB are not supported"
+            };
+        }
+
+        auto file = std::make_unique<File>();
+        file->path = std::move(filepath);
+        file->buffer = std::move(buffer);
+
+        std::unique_lock const lock{m_mutex};
+        m_files.push_back(std::move(file));
+        return static_cast<FileID>(m_files.size());
+    }
+
+    auto SourceManager::buffer(FileID const file) const -> SPtr<SourceBuffer const> {
+        return file == noFile ? nullptr : this->file(file).buffer;
+    }
+
+    auto SourceManager::path(FileID const file) const -> fs::path const& {
+        static fs::path const none{};
+        return file == noFile ? none : this->file(file).path;
+    }
+
+    auto SourceManager::location(SourceLocation const location) const -> Location {
+        if (location.file == noFile) {
+            return {0, location.offset};
+        }
+
+        auto& file = this->file(location.file);
+        auto const line = lineOf(file, location.offset);
+        auto const start = file.lineStarts[line];
+        auto const tabs = static_cast<szt>(rng::count(
+            textOf(file.buffer).substr(start, location.offset - start), '\t'
+        ));
+        return {line, location.offset - start + tabs * (tabSize - 1)};
+    }
+
+    auto SourceManager::snippet(SourceLocation const location) const -> StrV {
+        if (location.file == noFile) {
+            return {};
+        }
+
+        auto& file = this->file(location.file);
+        auto const text = textOf(file.buffer);
+        auto const line = lineOf(file, location.offset);
+        auto const start = std::min<szt>(file.lineStarts[line], text.size());
+        auto snippet = text.substr(start, text.find('\n', start) - start);
+        if (snippet.ends_with('\r')) {
+            snippet.remove_suffix(1);
+        }
+        return snippet;
+    }
+
+    auto SourceManager::file(FileID const id) const -> File& {
+        std::shared_lock const lock{m_mutex};
+        if (id == noFile || id > m_files.size()) {
+            throw InternalException{"Unknown FileID " + std::to_string(id)};
+        }
+        return *m_files[id - 1];
+    }
+
+    auto SourceManager::lineOf(File& file, u32 const offset) -> szt {
+        std::call_once(file.lineStartsFlag, [&] {
+            file.lineStarts = lineStartsOf(textOf(file.buffer));
+        });
+        return static_cast<szt>(
+            rng::upper_bound(file.lineStarts, offset) - file.lineStarts.begin()
+        ) - 1;
+    }
+}
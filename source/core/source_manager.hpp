@@ -0,0 +1,69 @@
+#ifndef TLC_CORE_SOURCE_MANAGER_HPP
+#define TLC_CORE_SOURCE_MANAGER_HPP
+
+#include "type.hpp"
+#include "utility.hpp"
+#include "singleton.hpp"
+#include "source_buffer.hpp"
+
+#include <shared_mutex>
+
+namespace tlc {
+    /**
+     * Sources of the compilation, referred to by FileID. Each file is loaded
+     * once and kept alive until the end of the program, so that tokens, nodes
+     * and errors only need a SourceLocation to name their file, line, column
+     * and source line. Lines and columns are computed on demand from a
+     * line-start table built on first use.
+     */
+    class SourceManager : public Singleton {
+        TLC_CORE_GENERATE_SINGLETON_BODY_PREFIX(SourceManager)
+
+    public:
+        // todo: dynamic tabsize
+        static constexpr szt tabSize = 4;
+
+        // the file of default locations, it has no source
+        static constexpr FileID noFile = 0;
+
+        // the same FileID is returned for every path naming the same file
+        auto load(fs::path const& filepath) -> FileID;
+
+        auto add(SPtr<SourceBuffer const> buffer, fs::path filepath = {})
+            -> FileID;
+
+        [[nodiscard]] auto buffer(FileID file) const -> SPtr<SourceBuffer const>;
+
+        [[nodiscard]] auto path(FileID file) const -> fs::path const&;
+
+        /**
+         * Line and column of {location}, both zero-based with tabs counted as
+         * tabSize columns. Offsets in noFile are treated as columns.
+         */
+        [[nodiscard]] auto location(SourceLocation location) const -> Location;
+
+        // the line {location} is on, without its line break
+        [[nodiscard]] auto snippet(SourceLocation location) const -> StrV;
+
+    private:
+        struct File {
+            fs::path path;
+            SPtr<SourceBuffer const> buffer;
+            std::once_flag lineStartsFlag{};
+            Vec<u32> lineStarts{};
+        };
+
+        [[nodiscard]] auto file(FileID id) const -> File&;
+
+        // index of the line {offset} is on
+        [[nodiscard]] static auto lineOf(File& file, u32 offset) -> szt;
+
+    private:
+        mutable std::shared_mutex m_mutex{};
+        // files never move once added, their line starts are filled in place
+        Vec<Ptr<File>> m_files{};
+        HashMap<Str, FileID> m_loaded{};
+    };
+}
+
+#endif // TLC_CORE_SOURCE_MANAGER_HPP
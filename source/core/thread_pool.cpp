@@ -0,0 +1,31 @@
+#include "thread_pool.hpp"
+
+namespace tlc {
+    ThreadPool::ThreadPool(szt const threadCount) {
+        m_workers.reserve(threadCount);
+        for (szt i = 0; i < threadCount; ++i) {
+            m_workers.emplace_back([this](std::stop_token const& stop) {
+                work(stop);
+            });
+        }
+    }
+
+    auto ThreadPool::work(std::stop_token const& stop) -> void {
+        while (true) {
+            std::move_only_function<void()> task;
+            {
+                std::unique_lock lock{m_mutex};
+                m_available.wait(lock, stop, [this] {
+                    return !m_tasks.empty();
+                });
+                if (m_tasks.empty()) {
+                    // stop was requested and nothing is left to run
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+            task();
+        }
+    }
+}
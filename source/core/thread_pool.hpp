@@ -0,0 +1,56 @@
+#ifndef TLC_CORE_THREAD_POOL_HPP
+#define TLC_CORE_THREAD_POOL_HPP
+
+#include "type.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace tlc {
+    /**
+     * Fixed set of worker threads running submitted tasks in FIFO order.
+     * Tasks still queued when the pool is destroyed are run before the
+     * workers are joined.
+     */
+    class ThreadPool final {
+    public:
+        explicit ThreadPool(
+            szt threadCount = std::max(std::thread::hardware_concurrency(), 1u)
+        );
+
+        ThreadPool(ThreadPool const&) = delete;
+        auto operator=(ThreadPool const&) -> ThreadPool& = delete;
+
+        template <std::invocable F>
+        auto submit(F task) -> std::future<std::invoke_result_t<F>> {
+            std::packaged_task<std::invoke_result_t<F>()> packaged{std::move(task)};
+            auto result = packaged.get_future();
+            {
+                std::scoped_lock const lock{m_mutex};
+                m_tasks.emplace(std::move(packaged));
+            }
+            m_available.notify_one();
+            return result;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_workers.size();
+        }
+
+    private:
+        auto work(std::stop_token const& stop) -> void;
+
+    private:
+        std::mutex m_mutex{};
+        std::condition_variable_any m_available{};
+        std::queue<std::move_only_function<void()>> m_tasks{};
+        // declared last so that the workers are joined first
+        Vec<std::jthread> m_workers{};
+    };
+}
+
+#endif // TLC_CORE_THREAD_POOL_HPP
@@ -50,6 +50,15 @@ namespace tlc {
         szt line{}, column{};
     };
 
+    // handle of a source registered with the SourceManager
+    using FileID = u32;
+
+    // compact location stored by tokens and nodes, see SourceManager::location
+    struct SourceLocation {
+        u32 offset{};
+        FileID file{};
+    };
+
     using Str = std::string;
     using StrV = std::string_view;
     using std::literals::operator ""s;
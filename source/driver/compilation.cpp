@@ -0,0 +1,31 @@
+#include "compilation.hpp"
+
+#include "lex/lex.hpp"
+
+namespace tlc::driver {
+    auto parseUnits(Span<FileID const> const units, szt const threads)
+        -> ParsedUnits {
+        using Collector = ErrorCollector<
+            parse::EParseErrorContext, parse::EParseErrorReason
+        >;
+
+        ParsedUnits parsed{.trees = Vec<syntax::Node>(units.size())};
+        {
+            ThreadPool pool{threads};
+            Vec<std::future<void>> pending;
+            pending.reserve(units.size());
+            for (u32 index = 0; index < units.size(); ++index) {
+                pending.push_back(pool.submit([&tree = parsed.trees[index], file = units[index], index] {
+                    Collector::instance().unit(index);
+                    tree = parse::Parse::operator()(lex::Lex{file});
+                }));
+            }
+            for (auto& unit : pending) {
+                unit.get();
+            }
+        }
+
+        parsed.errors = Collector::instance().merged();
+        return parsed;
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef TLC_DRIVER_COMPILATION_HPP
+#define TLC_DRIVER_COMPILATION_HPP
+
+#include "core/core.hpp"
+#include "parse/parse.hpp"
+
+namespace tlc::driver {
+    using ParseError = Error<parse::EParseErrorContext, parse::EParseErrorReason>;
+
+    struct ParsedUnits final {
+        // in the order of the units
+        Vec<syntax::Node> trees;
+        // of every unit, in the order of ErrorCollector::merged()
+        Vec<ParseError> errors;
+    };
+
+    /**
+     * Lexes and parses {units} on {threads} threads. Each unit is numbered
+     * after its position in {units}, so the errors are drained in the same
+     * order whatever the number of threads, even between units that have
+     * the same path.
+     */
+    auto parseUnits(
+        Span<FileID const> units,
+        szt threads = std::max(std::thread::hardware_concurrency(), 1u)
+    ) -> ParsedUnits;
+}
+
+#endif // TLC_DRIVER_COMPILATION_HPP
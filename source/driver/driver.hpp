@@ -4,6 +4,7 @@
 #include "core/core.hpp"
 
 #include "command.hpp"
+#include "compilation.hpp"
 #include "project.hpp"
 
 #endif // TLC_DRIVER_HPP
@@ -7,11 +7,18 @@
 #include <print>
 #include <iostream>
 
-int protected_main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+int protected_main(int argc, char** argv) {
     TLC_SCOPE_REPORTER();
-    TLC_LOG(tlc::ELogLevel::Warning, "This is a warning");
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    return EXIT_SUCCESS;
+    auto const units = tlc::Span<char* const>{argv + 1, argv + argc} |
+        tlc::rv::transform([](char const* const path) {
+            return tlc::SourceManager::instance().load(path);
+        }) | tlc::rng::to<tlc::Vec<tlc::FileID>>();
+
+    auto const [trees, errors] = tlc::driver::parseUnits(units);
+    for (auto const& error : errors) {
+        std::print(stderr, "{}\n", static_cast<tlc::CompileException>(error).what());
+    }
+    return errors.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 int main(int argc, char** argv) {
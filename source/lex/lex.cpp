@@ -1,8 +1,13 @@
 #include "lex.hpp"
 
 #include "util.hpp"
+#include "split.hpp"
 
 namespace tlc::lex {
+    auto Lex::operator()(FileID const file) -> token::TokenizedBuffer {
+        return Lex{file}();
+    }
+
     auto Lex::operator()(fs::path const& filepath) -> token::TokenizedBuffer {
         return Lex{filepath}();
     }
@@ -11,40 +16,90 @@ namespace tlc::lex {
         return Lex{std::move(iss)}();
     }
 
+    auto Lex::operator()(FileID const file, ThreadPool& pool) -> token::TokenizedBuffer {
+        auto const source = SourceManager::instance().buffer(file);
+        auto const size = source ? source->size() : 0;
+        auto const cuts = splitAtSafeNewlines(
+            source ? source->view() : StrV{},
+            std::min(pool.size() * chunksPerThread, size / minChunkSize)
+        );
+        if (cuts.size() <= 2) {
+            return Lex{file}();
+        }
+
+        Vec<std::future<token::TokenizedBuffer>> chunks;
+        chunks.reserve(cuts.size() - 1);
+        for (szt i = 0; i + 1 < cuts.size(); ++i) {
+            chunks.push_back(pool.submit([file, begin = cuts[i], end = cuts[i + 1]] {
+                return Lex{file, begin, end}();
+            }));
+        }
+
+        auto tokens = chunks.front().get();
+        for (auto& chunk : chunks | rv::drop(1)) {
+            tokens.append(chunk.get());
+        }
+        return tokens;
+    }
+
     auto Lex::operator()() -> token::TokenizedBuffer {
         m_stream.consumeSpaces();
         while (!m_stream.done()) {
-            m_currentStr = "";
-            m_currentLexeme = lexeme::invalid;
+            lexNext();
+        }
 
-            if (m_stream.match(isCommentOuter)) {
-                markTokenLocation();
-                appendStr();
-                lexComment();
-            }
-            else if (m_stream.match(isDigit)) {
-                markTokenLocation();
-                appendStr();
-                lexNumeric();
-            }
-            else if (m_stream.match(isLetter)) {
-                markTokenLocation();
-                appendStr();
-                lexIdentifier();
-            }
-            else if (m_stream.match(isStringTerminator)) {
-                markTokenLocation();
-                lexString();
+        return std::move(m_tokens);
+    }
+
+    auto Lex::next() -> Opt<token::TokenView> {
+        if (m_nextToken == m_tokens.size()) {
+            m_tokens.clear();
+            m_nextToken = 0;
+
+            m_stream.consumeSpaces();
+            while (m_tokens.empty() && !m_stream.done()) {
+                lexNext();
             }
-            else {
-                m_stream.advance();
-                markTokenLocation();
-                lexSymbol();
+
+            if (m_tokens.empty()) {
+                return {};
             }
+        }
 
-            m_stream.consumeSpaces();
+        return m_tokens.view(m_nextToken++);
+    }
+
+    // lexes a single token, or a string with all of its fragments, and the
+    // spaces after it
+    auto Lex::lexNext() -> void {
+        m_currentStr = "";
+        m_currentLexeme = lexeme::invalid;
+
+        if (m_stream.match(isCommentOuter)) {
+            markTokenLocation();
+            appendStr();
+            lexComment();
+        }
+        else if (m_stream.match(isDigit)) {
+            markTokenLocation();
+            appendStr();
+            lexNumeric();
+        }
+        else if (m_stream.match(isLetter)) {
+            markTokenLocation();
+            appendStr();
+            lexIdentifier();
+        }
+        else if (m_stream.match(isStringTerminator)) {
+            markTokenLocation();
+            lexString();
+        }
+        else {
+            m_stream.advance();
+            markTokenLocation();
+            lexSymbol();
         }
 
-        return m_tokens;
+        m_stream.consumeSpaces();
     }
 }
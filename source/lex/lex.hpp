@@ -9,18 +9,57 @@
 namespace tlc::lex {
     class Lex final {
     public:
+        static auto operator()(FileID file) -> token::TokenizedBuffer;
         static auto operator()(fs::path const& filepath) -> token::TokenizedBuffer;
         static auto operator()(std::istringstream iss) -> token::TokenizedBuffer;
 
+        /**
+         * Lexes chunks of the file split by splitAtSafeNewlines() on {pool}
+         * and stitches their tokens together, the result is the same as
+         * lexing the file serially. Files too small to be worth splitting are
+         * lexed on the calling thread.
+         */
+        static auto operator()(FileID file, ThreadPool& pool) -> token::TokenizedBuffer;
+
+        explicit Lex(FileID const file)
+            : m_stream{SourceManager::instance().buffer(file)},
+              m_tokens{file} {}
+
         explicit Lex(fs::path const& filepath)
-            : m_stream{filepath} {}
+            : Lex{SourceManager::instance().load(filepath)} {}
 
         explicit Lex(std::istringstream iss)
-            : m_stream{std::move(iss)} {}
+            : Lex{SourceManager::instance().add(
+                std::make_shared<SourceBuffer const>(std::move(iss))
+            )} {}
 
         auto operator()() -> token::TokenizedBuffer;
 
+        /**
+         * Lexes just enough of the source to return the next token, or nothing
+         * once the source is exhausted. Only the tokens of the construct lexed
+         * last are kept, so memory does not grow with the size of the file.
+         * The spelling of a string fragment with escapes refers to the lexer
+         * and is only valid until the next call, any other one to the source.
+         */
+        auto next() -> Opt<token::TokenView>;
+
+        [[nodiscard]] auto file() const noexcept -> FileID {
+            return m_tokens.file();
+        }
+
     private:
+        // chunks of at least this many bytes are lexed in parallel
+        static constexpr szt minChunkSize = 64 * 1024;
+        // more chunks than threads even out chunks that lex slower
+        static constexpr szt chunksPerThread = 4;
+
+        Lex(FileID const file, szt const begin, szt const end)
+            : m_stream{SourceManager::instance().buffer(file), begin, end},
+              m_tokens{file} {}
+
+        auto lexNext() -> void;
+
         auto lexComment() -> void;
         auto lexIdentifier() -> void;
         auto lexFloatingPoint() -> void;
@@ -28,13 +67,13 @@ namespace tlc::lex {
         auto lexNumeric() -> void;
         auto lexSymbol() -> void;
         auto lexString() -> void;
+        auto lexPlaceholder() -> void;
 
     private:
         auto classifyIdentifier(StrV lexeme) -> void;
 
         auto markTokenLocation() -> void {
-            m_tokenLine = m_stream.line();
-            m_tokenColumn = m_stream.column();
+            m_tokenOffset = m_stream.offset();
         }
 
         auto appendStr() -> void {
@@ -45,24 +84,33 @@ namespace tlc::lex {
             m_currentStr += c;
         }
 
+        auto appendStr(StrV const str) -> void {
+            m_currentStr += str;
+        }
+
         auto appendToken() -> void {
             if (m_currentLexeme == lexeme::invalid) {
                 // todo: throw
                 return;
             }
 
-            m_tokens.emplace_back(
-                m_currentLexeme, m_currentStr,
-                Location{m_tokenLine, m_tokenColumn}
+            m_tokens.push(
+                m_currentLexeme, m_tokenOffset,
+                m_stream.offset() + 1 - m_tokenOffset, m_currentStr
             );
         }
 
+        // appends the numeric literal lexed last along with its value
+        auto appendNumber() -> void;
+
     private:
         TextStream m_stream;
         lexeme::Lexeme m_currentLexeme = lexeme::invalid;
         Str m_currentStr{};
-        szt m_tokenLine{}, m_tokenColumn{};
+        szt m_tokenOffset{};
         token::TokenizedBuffer m_tokens{};
+        // next token of m_tokens to be returned by next()
+        token::TokenIndex m_nextToken{};
     };
 }
 
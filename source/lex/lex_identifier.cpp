@@ -1,31 +1,24 @@
 #include "lex.hpp"
 #include "util.hpp"
+#include "scan.hpp"
 
 namespace tlc::lex {
     auto Lex::classifyIdentifier(StrV const lexeme)
         -> void {
-        if (isLowerCaseLetter(lexeme.front())) {
-            if (lexeme::nonTypeKeywordTable.contains(lexeme)) {
-                m_currentLexeme = lexeme::nonTypeKeywordTable.at(lexeme);
-            }
-            else {
-                m_currentLexeme = lexeme::identifier;
-            }
+        if (auto const reserved = lexeme::reservedName(lexeme);
+            reserved != lexeme::empty) {
+            m_currentLexeme = reserved;
+        }
+        else if (isLowerCaseLetter(lexeme.front())) {
+            m_currentLexeme = lexeme::identifier;
         }
         else {
-            if (lexeme::fundamentalTypes.contains(lexeme)) {
-                m_currentLexeme = lexeme::fundamentalType;
-            }
-            else {
-                m_currentLexeme = lexeme::userDefinedType;
-            }
+            m_currentLexeme = lexeme::userDefinedType;
         }
     }
 
     auto Lex::lexIdentifier() -> void {
-        while (m_stream.match(isDigitOrLetter)) {
-            appendStr();
-        }
+        appendStr(m_stream.consume(scanIdentifier));
         classifyIdentifier(m_currentStr);
         appendToken();
     }
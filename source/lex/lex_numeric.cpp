@@ -1,7 +1,52 @@
 #include "lex.hpp"
 #include "util.hpp"
 
+#include <charconv>
+
 namespace tlc::lex {
+    namespace {
+        template <typename T, typename... Base>
+        auto parseNumber(StrV const digits, Base const... base) -> token::NumericValue {
+            T value{};
+            auto const end = digits.data() + digits.size();
+            if (auto const [last, error] = std::from_chars(
+                    digits.data(), end, value, base...
+                ); error != std::errc{} || last != end) {
+                // out of range or malformed
+                return {};
+            }
+            return value;
+        }
+
+        auto numericValue(lexeme::Lexeme const lexeme, StrV const spelling)
+            -> token::NumericValue {
+            switch (lexeme.type()) {
+            case lexeme::Lexeme::Integer2Literal:
+                return parseNumber<i64>(spelling.substr(2), 2);
+            case lexeme::Lexeme::Integer8Literal:
+                return parseNumber<i64>(spelling.substr(1), 8);
+            case lexeme::Lexeme::Integer16Literal:
+                return parseNumber<i64>(spelling.substr(2), 16);
+            case lexeme::Lexeme::FloatLiteral:
+                return parseNumber<f64>(spelling);
+            default:
+                return parseNumber<i64>(spelling, 10);
+            }
+        }
+    }
+
+    auto Lex::appendNumber() -> void {
+        if (m_currentLexeme == lexeme::invalid) {
+            // todo: throw
+            return;
+        }
+
+        m_tokens.pushNumber(
+            m_currentLexeme, m_tokenOffset, m_stream.offset() + 1 - m_tokenOffset,
+            numericValue(m_currentLexeme, m_currentStr)
+        );
+    }
+
     auto Lex::lexFloatingPoint() -> void {
         if (m_stream.match(isStartOfDecimalPart)) {
             appendStr();
@@ -57,7 +102,7 @@ namespace tlc::lex {
             m_currentLexeme = lexeme::integer10Literal;
         }
 
-        appendToken();
+        appendNumber();
     }
 
     auto Lex::lexNumeric() -> void {
@@ -71,6 +116,6 @@ namespace tlc::lex {
         }
         lexFloatingPoint();
 
-        appendToken();
+        appendNumber();
     }
 }
@@ -1,5 +1,6 @@
 #include "lex.hpp"
 #include "util.hpp"
+#include "scan.hpp"
 
 namespace tlc::lex {
     auto Lex::lexString() -> void {
@@ -77,39 +78,14 @@ namespace tlc::lex {
                 escaped = true;
             }
             else if (c == '{') {
-                // consume string until the correct enclosing character '}' is found.
-                // the consumed string will be "re-lexed" from a parser
-                appendToken();
-                markTokenLocation();
-                m_currentStr = "";
-                m_currentLexeme = lexeme::stringPlaceholder;
-
-                szt left = 1, right = 0;
-                c8 last = m_stream.current();
-                while (left != right) {
-                    m_stream.advance();
-
-                    auto const cc = m_stream.current();
-                    if (cc == '{' && last != '\\') {
-                        ++left;
-                    }
-                    else if (cc == '}' && last != '\\') {
-                        ++right;
-                    }
-                    else {
-                        appendStr();
-                    }
-                    last = cc;
-                }
-
-                if (left != right) {
-                    // todo: error
-                }
                 appendToken();
+                lexPlaceholder();
                 lastTokenIsPlaceholder = true;
             }
             else {
                 appendStr();
+                // plain characters are copied in bulk up to the next special one
+                appendStr(m_stream.consume(scanStringFragment));
             }
         }
 
@@ -123,4 +99,28 @@ namespace tlc::lex {
 
         appendToken();
     }
+
+    auto Lex::lexPlaceholder() -> void {
+        // the contents are lexed as ordinary tokens, so that the parser
+        // handles them inline
+        m_tokens.push(lexeme::placeholderBegin, m_stream.offset(), 1, "{");
+
+        szt depth = 0;
+        m_stream.consumeSpaces();
+        while (!m_stream.done() && (depth > 0 || m_stream.peek() != '}')) {
+            if (m_stream.peek() == '{') {
+                ++depth;
+            }
+            else if (m_stream.peek() == '}') {
+                --depth;
+            }
+            lexNext();
+        }
+
+        if (!m_stream.match('}')) {
+            // todo: error
+            return;
+        }
+        m_tokens.push(lexeme::placeholderEnd, m_stream.offset(), 1, "}");
+    }
 }
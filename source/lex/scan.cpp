@@ -0,0 +1,192 @@
+#include "scan.hpp"
+#include "util.hpp"
+
+#include <bit>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__)) && defined(__SSE2__)
+#define TLC_LEX_SCAN_X86
+#define TLC_LEX_SCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace tlc::lex {
+    namespace {
+        enum class ECharClass {
+            Space, Identifier, StringFragment,
+        };
+
+        template <ECharClass C>
+        constexpr auto accepts(c8 const c) -> b8 {
+            if constexpr (C == ECharClass::Space) {
+                return c == ' ' || c == '\t' || c == '\n';
+            }
+            else if constexpr (C == ECharClass::Identifier) {
+                return isDigitOrLetter(c);
+            }
+            else {
+                return c != '"' && c != '\\' && c != '{' && c != '\n' &&
+                    c != '\r';
+            }
+        }
+
+        template <ECharClass C>
+        auto scanScalar(StrV const text, szt pos = 0) -> szt {
+            while (pos < text.size() && accepts<C>(text[pos])) {
+                ++pos;
+            }
+            return pos;
+        }
+
+#ifdef TLC_LEX_SCAN_X86
+        // bit i is set if data[i] does not belong to C
+        template <ECharClass C>
+        auto stopMask16(c8 const* data) -> u32 {
+            auto const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+            auto const eq = [chunk](c8 const c) {
+                return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(c));
+            };
+
+            __m128i accepted;
+            if constexpr (C == ECharClass::Space) {
+                accepted = _mm_or_si128(
+                    _mm_or_si128(eq(' '), eq('\t')), eq('\n')
+                );
+            }
+            else if constexpr (C == ECharClass::Identifier) {
+                // bytes >= 0x80 are negative and fail both ranges, setting
+                // 0x20 maps upper case letters onto lower case ones only
+                auto const folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+                accepted = _mm_or_si128(
+                    _mm_and_si128(
+                        _mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+                        _mm_cmplt_epi8(chunk, _mm_set1_epi8('9' + 1))
+                    ),
+                    _mm_and_si128(
+                        _mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)),
+                        _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1))
+                    )
+                );
+            }
+            else {
+                return static_cast<u32>(_mm_movemask_epi8(_mm_or_si128(
+                    _mm_or_si128(_mm_or_si128(eq('"'), eq('\\')), eq('{')),
+                    _mm_or_si128(eq('\n'), eq('\r'))
+                )));
+            }
+            return ~static_cast<u32>(_mm_movemask_epi8(accepted)) & 0xffffu;
+        }
+
+        template <ECharClass C>
+        TLC_LEX_SCAN_TARGET_AVX2
+        auto stopMask32(c8 const* data) -> u32 {
+            auto const chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data));
+            auto const eq = [chunk](c8 const c) TLC_LEX_SCAN_TARGET_AVX2 {
+                return _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(c));
+            };
+
+            __m256i accepted;
+            if constexpr (C == ECharClass::Space) {
+                accepted = _mm256_or_si256(
+                    _mm256_or_si256(eq(' '), eq('\t')), eq('\n')
+                );
+            }
+            else if constexpr (C == ECharClass::Identifier) {
+                auto const folded = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+                accepted = _mm256_or_si256(
+                    _mm256_and_si256(
+                        _mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('0' - 1)),
+                        _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chunk)
+                    ),
+                    _mm256_and_si256(
+                        _mm256_cmpgt_epi8(folded, _mm256_set1_epi8('a' - 1)),
+                        _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), folded)
+                    )
+                );
+            }
+            else {
+                return static_cast<u32>(_mm256_movemask_epi8(_mm256_or_si256(
+                    _mm256_or_si256(_mm256_or_si256(eq('"'), eq('\\')), eq('{')),
+                    _mm256_or_si256(eq('\n'), eq('\r'))
+                )));
+            }
+            return ~static_cast<u32>(_mm256_movemask_epi8(accepted));
+        }
+
+        template <ECharClass C>
+        auto scanSse2(StrV const text) -> szt {
+            szt pos = 0;
+            for (; pos + 16 <= text.size(); pos += 16) {
+                if (auto const mask = stopMask16<C>(text.data() + pos); mask != 0) {
+                    return pos + static_cast<szt>(std::countr_zero(mask));
+                }
+            }
+            return scanScalar<C>(text, pos);
+        }
+
+        template <ECharClass C>
+        TLC_LEX_SCAN_TARGET_AVX2
+        auto scanAvx2(StrV const text) -> szt {
+            szt pos = 0;
+            for (; pos + 32 <= text.size(); pos += 32) {
+                if (auto const mask = stopMask32<C>(text.data() + pos); mask != 0) {
+                    return pos + static_cast<szt>(std::countr_zero(mask));
+                }
+            }
+            return pos + scanSse2<C>(text.substr(pos));
+        }
+#endif
+
+        auto detectSimdLevel() -> ESimdLevel {
+#ifdef TLC_LEX_SCAN_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return ESimdLevel::AVX2;
+            }
+            return ESimdLevel::SSE2;
+#else
+            return ESimdLevel::Scalar;
+#endif
+        }
+
+        template <ECharClass C>
+        auto scan(StrV const text, ESimdLevel const level) -> szt {
+            switch (std::min(level, simdLevel())) {
+#ifdef TLC_LEX_SCAN_X86
+            case ESimdLevel::AVX2: return scanAvx2<C>(text);
+            case ESimdLevel::SSE2: return scanSse2<C>(text);
+#endif
+            default: return scanScalar<C>(text);
+            }
+        }
+    }
+
+    auto simdLevel() -> ESimdLevel {
+        static ESimdLevel const level = detectSimdLevel();
+        return level;
+    }
+
+    auto scanSpaces(StrV const text) -> szt {
+        return scan<ECharClass::Space>(text, simdLevel());
+    }
+
+    auto scanSpaces(StrV const text, ESimdLevel const level) -> szt {
+        return scan<ECharClass::Space>(text, level);
+    }
+
+    auto scanIdentifier(StrV const text) -> szt {
+        return scan<ECharClass::Identifier>(text, simdLevel());
+    }
+
+    auto scanIdentifier(StrV const text, ESimdLevel const level) -> szt {
+        return scan<ECharClass::Identifier>(text, level);
+    }
+
+    auto scanStringFragment(StrV const text) -> szt {
+        return scan<ECharClass::StringFragment>(text, simdLevel());
+    }
+
+    auto scanStringFragment(StrV const text, ESimdLevel const level) -> szt {
+        return scan<ECharClass::StringFragment>(text, level);
+    }
+}
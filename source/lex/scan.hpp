@@ -0,0 +1,38 @@
+#ifndef TLC_LEX_SCAN_HPP
+#define TLC_LEX_SCAN_HPP
+
+#include "core/core.hpp"
+
+namespace tlc::lex {
+    enum class ESimdLevel {
+        Scalar, SSE2, AVX2,
+    };
+
+    /**
+     * The widest instruction set supported by the running CPU. It is
+     * detected once and then used by all scanners below.
+     */
+    auto simdLevel() -> ESimdLevel;
+
+    /**
+     * Each scanner returns the length of the longest prefix of the given text
+     * whose characters belong to the scanned class. The overloads taking an
+     * ESimdLevel force a narrower implementation, which is mainly useful for
+     * testing, and fall back to simdLevel() when the requested level is not
+     * supported.
+     */
+
+    // ' ', '\t' and '\n'. '\r' is left to TextStream since it skips a line.
+    auto scanSpaces(StrV text) -> szt;
+    auto scanSpaces(StrV text, ESimdLevel level) -> szt;
+
+    // digits and letters, see isDigitOrLetter
+    auto scanIdentifier(StrV text) -> szt;
+    auto scanIdentifier(StrV text, ESimdLevel level) -> szt;
+
+    // anything but '"', '\\', '{', '\n' and '\r'
+    auto scanStringFragment(StrV text) -> szt;
+    auto scanStringFragment(StrV text, ESimdLevel level) -> szt;
+}
+
+#endif // TLC_LEX_SCAN_HPP
@@ -0,0 +1,90 @@
+#include "split.hpp"
+
+namespace tlc::lex {
+    namespace {
+        auto skipPlaceholder(StrV source, szt pos) -> szt;
+
+        // mirrors Lex::lexString, returns where the string that was opened
+        // right before {pos} ends
+        auto skipString(StrV const source, szt pos) -> szt {
+            b8 escaped = false;
+            while (pos < source.size()) {
+                auto const c = source[pos];
+                if (c == '"') {
+                    return pos + 1;
+                }
+                if (c == '\n') {
+                    return pos;
+                }
+
+                ++pos;
+                if (escaped) {
+                    escaped = false;
+                }
+                else if (c == '\\') {
+                    escaped = true;
+                }
+                else if (c == '{') {
+                    pos = skipPlaceholder(source, pos);
+                }
+            }
+            return pos;
+        }
+
+        // mirrors Lex::lexPlaceholder, its tokens may span lines and contain
+        // strings and braces of their own
+        auto skipPlaceholder(StrV const source, szt pos) -> szt {
+            szt depth = 0;
+            while (pos < source.size()) {
+                auto const c = source[pos++];
+                if (c == '"') {
+                    pos = skipString(source, pos);
+                }
+                else if (c == '{') {
+                    ++depth;
+                }
+                else if (c == '}') {
+                    if (depth == 0) {
+                        return pos;
+                    }
+                    --depth;
+                }
+            }
+            return pos;
+        }
+    }
+
+    auto splitAtSafeNewlines(StrV const source, szt const count) -> Vec<szt> {
+        Vec<szt> cuts{0};
+        if (count > 1 && source.find('\r') == StrV::npos) {
+            auto const target = [&](szt const i) {
+                return source.size() * i / count;
+            };
+
+            szt next = 1;
+            for (szt pos = 0; pos < source.size() && next < count;) {
+                // newlines before the next string are all safe
+                auto const quote = source.find('"', pos);
+                auto const newline = source.find('\n', std::max(pos, target(next)));
+                if (newline < quote) {
+                    cuts.push_back(newline + 1);
+                    pos = newline + 1;
+                    while (next < count && target(next) <= newline) {
+                        ++next;
+                    }
+                }
+                else if (quote != StrV::npos) {
+                    pos = skipString(source, quote + 1);
+                }
+                else {
+                    break;
+                }
+            }
+        }
+
+        if (cuts.back() != source.size()) {
+            cuts.push_back(source.size());
+        }
+        return cuts;
+    }
+}
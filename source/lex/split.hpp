@@ -0,0 +1,18 @@
+#ifndef TLC_LEX_SPLIT_HPP
+#define TLC_LEX_SPLIT_HPP
+
+#include "core/core.hpp"
+
+namespace tlc::lex {
+    /**
+     * Offsets that split {source} into at most {count} chunks of roughly the
+     * same size, from 0 to source.size(). Every other offset follows a
+     * newline that is outside string literals and their placeholders, so
+     * that lexing the chunks separately yields the same tokens as lexing the
+     * whole source. Sources with a '\r' are not split since TextStream skips
+     * past the end of their lines.
+     */
+    auto splitAtSafeNewlines(StrV source, szt count) -> Vec<szt>;
+}
+
+#endif // TLC_LEX_SPLIT_HPP
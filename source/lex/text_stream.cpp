@@ -1,4 +1,5 @@
 #include "text_stream.hpp"
+#include "scan.hpp"
 
 namespace tlc::lex {
     auto TextStream::advance() -> void {
@@ -7,43 +8,36 @@ namespace tlc::lex {
         }
 
         // todo: comments
-        if (m_started) {
-            switch (m_currentChar) {
-            case '\t': {
-                m_column += tabSize;
-                break;
-            }
-            case '\r': {
-                m_filereader.skipLine();
-                [[fallthrough]];
-            }
-            case '\n': {
-                m_column = 0;
-                ++m_line;
-                break;
-            }
-            case ' ': {
-                ++m_column;
-                break;
-            }
-            default: {
-                ++m_column;
-            }
+        if (m_started && m_currentChar == '\r') {
+            skipLine();
+            if (done()) {
+                return;
             }
         }
 
-        if (auto const c = m_filereader.advance();
-            c != m_filereader.eof()) {
-            m_currentChar = c;
-            if (!m_started) {
-                m_started = true;
-                return;
-            }
-            ++m_pos;
+        m_started = true;
+        m_currentChar = m_text[m_pos++];
+    }
+
+    auto TextStream::advance(szt const n) -> void {
+        if (n == 0 || done()) {
+            return;
         }
+
+        advance();
+        m_pos += std::min(n - 1, m_text.size() - m_pos);
+        m_currentChar = m_text[m_pos - 1];
     }
 
     auto TextStream::consumeSpaces() -> void {
-        while (match(' ', '\t', '\r', '\n')) {}
+        do {
+            consume(scanSpaces);
+        }
+        while (match(' ', '\t', '\r', '\n'));
+    }
+
+    auto TextStream::skipLine() -> void {
+        auto const next = m_text.find('\n', m_pos);
+        m_pos = next == StrV::npos ? m_text.size() : next + 1;
     }
 }
@@ -5,23 +5,38 @@
 
 namespace tlc::lex {
     class TextStream {
-        // todo: dynamic tabsize
-        static constexpr szt tabSize = 4;
-
     public:
         TextStream() = default;
 
         explicit TextStream(fs::path const& filepath)
-            : m_filereader(filepath) {}
+            : m_source{std::make_shared<SourceBuffer const>(filepath)},
+              m_text{m_source->view()} {}
 
         explicit TextStream(std::istringstream iss)
-            : m_filereader(std::move(iss)) {}
+            : m_source{std::make_shared<SourceBuffer const>(std::move(iss))},
+              m_text{m_source->view()} {}
+
+        explicit TextStream(SPtr<SourceBuffer const> source)
+            : m_source{std::move(source)},
+              m_text{m_source ? m_source->view() : StrV{}} {}
 
-        [[nodiscard]] auto line() const -> szt { return m_line; }
-        [[nodiscard]] auto column() const -> szt { return m_column; }
+        // streams source[begin, end) while keeping offsets relative to the
+        // start of the source
+        TextStream(SPtr<SourceBuffer const> source, szt const begin, szt const end)
+            : m_source{std::move(source)},
+              m_text{m_source->view().substr(0, end)}, m_pos{begin} {}
+
+        [[nodiscard]] auto source() const -> SPtr<SourceBuffer const> const& {
+            return m_source;
+        }
+
+        // offset of the current character
+        [[nodiscard]] auto offset() const -> szt {
+            return m_pos == 0 ? 0 : m_pos - 1;
+        }
 
         auto match(std::same_as<char> auto... expected) -> bool {
-            if (done() || ((m_filereader.peek() != expected) && ...)) {
+            if (done() || ((peek() != expected) && ...)) {
                 return false;
             }
             advance();
@@ -29,7 +44,7 @@ namespace tlc::lex {
         }
 
         auto match(bool (*cond)(char)) -> bool {
-            if (done() || !cond(m_filereader.peek())) {
+            if (done() || !cond(peek())) {
                 return false;
             }
             advance();
@@ -38,24 +53,54 @@ namespace tlc::lex {
 
         auto advance() -> void;
 
+        /**
+         * Same as calling advance() {n} times as long as neither the current
+         * character nor the next {n} - 1 ones are '\r'.
+         */
+        auto advance(szt n) -> void;
+
+        /**
+         * Consumes the run of unread characters accepted by {scan} and returns
+         * it. The run is viewed from the source buffer, so it stays valid for
+         * the lifetime of the stream.
+         */
+        auto consume(szt (*scan)(StrV)) -> StrV {
+            if (m_currentChar == '\r') {
+                // the pending line skip cannot be accounted for in bulk
+                return {};
+            }
+            auto const run = remaining().substr(0, scan(remaining()));
+            advance(run.size());
+            return run;
+        }
+
         [[nodiscard]] auto peek() const -> char {
-            return m_filereader.peek();
+            return done() ? static_cast<char>(EOF) : m_text[m_pos];
         }
 
         auto consumeSpaces() -> void;
 
         [[nodiscard]] auto done() const -> bool {
-            return m_filereader.peek() == EOF;
+            return m_pos >= m_text.size();
         }
 
         [[nodiscard]] auto current() const -> char {
             return m_currentChar;
         }
 
+        [[nodiscard]] auto remaining() const -> StrV {
+            return m_text.substr(std::min(m_pos, m_text.size()));
+        }
+
+    private:
+        auto skipLine() -> void;
+
     private:
-        FileReader m_filereader;
+        SPtr<SourceBuffer const> m_source;
+        StrV m_text{};
         bool m_started{};
-        szt m_pos{}, m_line{}, m_column{};
+        // index of the next unread character
+        szt m_pos{};
         char m_currentChar{};
     };
 }
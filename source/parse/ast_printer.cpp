@@ -324,7 +324,7 @@ namespace tlc::parse {
         return SyntaxTreeVisitor::visitChildren(node) | rvJoinWithEl;
     }
 
-    auto ASTPrinter::visitChildren(auto node) -> Str {
+    auto ASTPrinter::visitChildren(auto const& node) -> Str {
         Str const depthPrefix = [](szt const d) constexpr static {
             if (d == 0) {
                 return prefix;
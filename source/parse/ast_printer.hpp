@@ -18,6 +18,11 @@ namespace tlc::parse {
             return std::visit(ASTPrinter{}, node);
         }
 
+        static auto operator()(syntax::Arena const& arena, syntax::NodeId const id)
+            -> Str {
+            return std::visit(ASTPrinter{}, arena.node(id));
+        }
+
     public:
         auto operator()(syntax::expr::Integer const& node) -> Str;
         auto operator()(syntax::expr::Float const& node) -> Str;
@@ -73,7 +78,7 @@ namespace tlc::parse {
         static constexpr auto rvJoinWithEl =
             rv::join_with('\n') | rng::to<Str>();
 
-        auto visitChildren(auto node) -> Str;
+        auto visitChildren(auto const& node) -> Str;
 
     private:
         szt m_depth = 0;
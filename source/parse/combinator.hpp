@@ -8,7 +8,7 @@
 
 namespace tlc::parse {
     using ParserCombinatorResult = Expected<
-        token::TokenizedBuffer, Error<EParseErrorContext, EParseErrorReason>
+        Vec<token::TokenView>, Error<EParseErrorContext, EParseErrorReason>
     >;
 
     using ParserCombinator = Fn<
@@ -44,7 +44,7 @@ namespace tlc::parse {
 
     inline auto many0(ParserCombinator const& pc) -> ParserCombinator {
         return TLC_PARSER_COMBINATOR_PROTOTYPE {
-            token::TokenizedBuffer tokens;
+            Vec<token::TokenView> tokens;
             auto result = pc(stream, tracker);
             while (result) {
                 tokens.append_range(*result);
@@ -86,7 +86,7 @@ namespace tlc::parse {
         std::same_as<ParserCombinator> auto&&... pc
     ) -> ParserCombinator {
         return TLC_PARSER_COMBINATOR_PROTOTYPE {
-            token::TokenizedBuffer tokens;
+            Vec<token::TokenView> tokens;
             auto streamBacktrack = stream.scopedBacktrack();
             for (auto&& p : {pc...}) {
                 auto const result = p(stream, tracker);
@@ -102,6 +102,127 @@ namespace tlc::parse {
             return tokens;
         };
     }
+    /**
+     * Tokens matched by a combinator of the templated layer, as the half-open
+     * range of their indices in the stream. They can be read back with
+     * TokenStream::at until the stream advances again.
+     */
+    struct TokenRange {
+        token::TokenIndex begin{};
+        token::TokenIndex end{};
+
+        [[nodiscard]] constexpr auto size() const noexcept -> szt {
+            return end - begin;
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> b8 {
+            return begin == end;
+        }
+    };
+
+    using TokenRangeResult = Expected<
+        TokenRange, Error<EParseErrorContext, EParseErrorReason>
+    >;
+
+    /**
+     * Same combinators as above, but each one is a distinct lambda type that
+     * stores its operands by value, so a whole grammar rule is composed at
+     * compile time without type erasure, and invoking it neither allocates
+     * nor copies tokens.
+     */
+    namespace combinator {
+        template <typename T>
+        concept IsCombinator = std::same_as<
+            std::invoke_result_t<T const&, TokenStream&, LocationTracker&>,
+            TokenRangeResult
+        >;
+
+#define TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE \
+    [=]([[maybe_unused]] TokenStream& stream, \
+    [[maybe_unused]] LocationTracker& tracker) \
+        -> TokenRangeResult
+
+        constexpr auto match(std::same_as<lexeme::Lexeme> auto... types) {
+            return TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE {
+                auto const begin = stream.nextIndex();
+                if (!stream.match(types...)) {
+                    return Unexpected{
+                        Error<EParseErrorContext, EParseErrorReason>{}
+                    };
+                }
+                return TokenRange{begin, stream.nextIndex()};
+            };
+        }
+
+        constexpr auto match(TokenStream::MatchFn const cond) {
+            return TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE {
+                auto const begin = stream.nextIndex();
+                if (!stream.match(cond)) {
+                    return Unexpected{
+                        Error<EParseErrorContext, EParseErrorReason>{}
+                    };
+                }
+                return TokenRange{begin, stream.nextIndex()};
+            };
+        }
+
+        constexpr auto many0(IsCombinator auto const pc) {
+            return TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE {
+                auto const begin = stream.nextIndex();
+                // never executed, it only keeps the matched tokens readable
+                auto const pin = stream.scopedBacktrack();
+                for (auto end = begin; pc(stream, tracker); ) {
+                    // stop on a match that consumed nothing instead of looping
+                    if (stream.nextIndex() == end) {
+                        break;
+                    }
+                    end = stream.nextIndex();
+                }
+                return TokenRange{begin, stream.nextIndex()};
+            };
+        }
+
+        constexpr auto many1(IsCombinator auto const pc) {
+            return TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE {
+                if (auto const result = many0(pc)(stream, tracker);
+                    !result->empty()) {
+                    return result;
+                }
+                return Unexpected{
+                    Error<EParseErrorContext, EParseErrorReason>{}
+                };
+            };
+        }
+
+        constexpr auto any(IsCombinator auto const... pc) {
+            return TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE {
+                TokenRangeResult result = Unexpected{
+                    Error<EParseErrorContext, EParseErrorReason>{}
+                };
+                static_cast<void>(((result = pc(stream, tracker)) || ...));
+                return result;
+            };
+        }
+
+        constexpr auto seq(IsCombinator auto const... pc) {
+            return TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE {
+                auto const begin = stream.nextIndex();
+                auto streamBacktrack = stream.scopedBacktrack();
+                if (!(pc(stream, tracker) && ...)) {
+                    // nothing to rewind if the first combinator failed
+                    if (stream.nextIndex() != begin) {
+                        streamBacktrack();
+                    }
+                    return Unexpected{
+                        Error<EParseErrorContext, EParseErrorReason>{}
+                    };
+                }
+                return TokenRange{begin, stream.nextIndex()};
+            };
+        }
+
+#undef TLC_TEMPLATED_PARSER_COMBINATOR_PROTOTYPE
+    }
 }
 
 #endif // TLC_PARSE_COMBINATOR_HPP
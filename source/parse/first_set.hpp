@@ -0,0 +1,78 @@
+#ifndef TLC_PARSE_FIRST_SET_HPP
+#define TLC_PARSE_FIRST_SET_HPP
+
+#include "core/core.hpp"
+#include "token/token.hpp"
+
+namespace tlc::parse {
+    // alternatives of a rule, picked by the first token of the input
+    enum class EPrimaryExpr : u8 {
+        None, Try, Literal, Path, Record, String, Tuple, Array,
+    };
+
+    enum class EStmt : u8 {
+        Expr, Return, Defer, Block, Match, Loop, Decl,
+    };
+
+    enum class EPrimaryType : u8 {
+        Identifier, Infer, Tuple,
+    };
+
+    template <typename E>
+    using FirstSet = Arr<E, lexeme::Lexeme::typeCount>;
+
+    template <typename E>
+    constexpr auto firstOf(FirstSet<E> const& table, lexeme::Lexeme const lexeme)
+        -> E {
+        return table[static_cast<szt>(lexeme.type())];
+    }
+
+    // a path is either an identifier or the type of a record, which only
+    // the tokens after it tell apart
+    constexpr auto primaryExprFirstSet = [] {
+        using enum lexeme::Lexeme::EType;
+        FirstSet<EPrimaryExpr> table{};
+        table[static_cast<szt>(Try)] = EPrimaryExpr::Try;
+        for (auto const type : {
+                 Integer2Literal, Integer8Literal, Integer10Literal,
+                 Integer16Literal, FloatLiteral, True, False
+             }) {
+            table[static_cast<szt>(type)] = EPrimaryExpr::Literal;
+        }
+        for (auto const type : {
+                 Identifier, Anonymous, Dollar, UserDefinedType, FundamentalType
+             }) {
+            table[static_cast<szt>(type)] = EPrimaryExpr::Path;
+        }
+        table[static_cast<szt>(LeftBrace)] = EPrimaryExpr::Record;
+        table[static_cast<szt>(StringFragment)] = EPrimaryExpr::String;
+        table[static_cast<szt>(LeftParen)] = EPrimaryExpr::Tuple;
+        table[static_cast<szt>(LeftBracket)] = EPrimaryExpr::Array;
+        return table;
+    }();
+
+    // statements starting with anything else are expression-prefixed,
+    // declarations are confirmed by the tokens after their first one
+    constexpr auto stmtFirstSet = [] {
+        using enum lexeme::Lexeme::EType;
+        FirstSet<EStmt> table{};
+        table[static_cast<szt>(Return)] = EStmt::Return;
+        table[static_cast<szt>(Defer)] = EStmt::Defer;
+        table[static_cast<szt>(LeftBrace)] = EStmt::Block;
+        table[static_cast<szt>(Match)] = EStmt::Match;
+        table[static_cast<szt>(For)] = EStmt::Loop;
+        table[static_cast<szt>(Identifier)] = EStmt::Decl;
+        table[static_cast<szt>(LeftParen)] = EStmt::Decl;
+        return table;
+    }();
+
+    constexpr auto typeFirstSet = [] {
+        using enum lexeme::Lexeme::EType;
+        FirstSet<EPrimaryType> table{};
+        table[static_cast<szt>(LeftBracket)] = EPrimaryType::Infer;
+        table[static_cast<szt>(LeftParen)] = EPrimaryType::Tuple;
+        return table;
+    }();
+}
+
+#endif // TLC_PARSE_FIRST_SET_HPP
@@ -3,10 +3,12 @@
 namespace tlc::parse {
     auto Parse::handleDecl() -> ParseResult {
         TLC_SCOPE_REPORTER();
-        return handleTupleDecl().or_else([this](auto&& error) -> ParseResult {
-            collect(error);
-            return handleIdentifierDecl();
-        });
+        if (m_stream.peek().lexeme() == lexeme::leftParen) {
+            return memoized(ERule::TupleDecl, [this] {
+                return handleTupleDecl();
+            });
+        }
+        return handleIdentifierDecl();
     }
 
     auto Parse::handleIdentifierDecl() -> ParseResult {
@@ -15,11 +17,11 @@ namespace tlc::parse {
 
         return match(lexeme::identifier)(m_stream, m_tracker).and_then(
             [&](auto const& tokens) -> ParseResult {
-                auto name = tokens.front().str();
+                auto const name = tokens.front().symbol();
 
                 if (!m_stream.match(lexeme::colon)) {
                     return syntax::decl::Identifier{
-                        tokens.front().str(), {}, *location
+                        name, {}, *location
                     };
                 }
 
@@ -32,7 +34,7 @@ namespace tlc::parse {
                     -> ParseResult {
                         collect(error);
                         return syntax::decl::Identifier{
-                            Str(name), {}, *location
+                            name, {}, *location
                         };
                     });
             }
@@ -101,7 +103,7 @@ namespace tlc::parse {
                          (m_stream, m_tracker)
                          .and_then([&](auto&& typeId) -> ParseResult {
                              return syntax::decl::GenericIdentifier{
-                                 Str(typeId.front().str()),
+                                 typeId.front().symbol(),
                                  m_tracker.current()
                              };
                          })
@@ -3,7 +3,272 @@
 #include "lex/lex.hpp"
 
 namespace tlc::parse {
-    auto Parse::handleExpr(syntax::OpPrecedence const minP) -> ParseResult { // NOLINT(*-no-recursion)
+    struct Parse::ExprGroup {
+        EGroup kind;
+        SourceLocation location{};
+        // of a record
+        syntax::Node type{};
+        Vec<syntax::Node> elements{};
+        // of the record entry being parsed
+        Symbol key{};
+        SourceLocation entryLocation{};
+
+        [[nodiscard]] auto opening() const noexcept -> lexeme::Lexeme {
+            return kind == EGroup::Tuple ? lexeme::leftParen :
+                kind == EGroup::Array ? lexeme::leftBracket :
+                lexeme::leftBrace;
+        }
+
+        [[nodiscard]] auto closing() const noexcept -> lexeme::Lexeme {
+            return kind == EGroup::Tuple ? lexeme::rightParen :
+                kind == EGroup::Array ? lexeme::rightBracket :
+                lexeme::rightBrace;
+        }
+    };
+
+    auto Parse::handleExpr(syntax::OpPrecedence const minP) -> ParseResult {
+        TLC_SCOPE_REPORTER();
+        if (m_recursiveExprs) {
+            return handleRecursiveExpr(minP);
+        }
+
+        /**
+         * handleRecursiveExpr with its call stack made explicit, along with
+         * the calls it makes for the try expressions, tuples, arrays and
+         * records among its operands. Each pending entry is what one of
+         * those calls would have kept: an operator and its left operand, a
+         * try, or a group whose elements are being parsed along with what it
+         * is the arguments or the subscript of. Each also keeps the minimum
+         * precedence and location of the expression it belongs to. Neither
+         * long chains of operators nor deeply nested groups take any stack
+         * space.
+         */
+        struct Pending {
+            enum class EKind : u8 {
+                Prefix, Binary, Try, Group, Arguments, Subscript,
+            };
+
+            EKind kind;
+            lexeme::Lexeme op;
+            syntax::OpPrecedence minP;
+            SourceLocation location;
+            // left operand of a binary operator, or what a group applies to
+            syntax::Node lhs{};
+        };
+        using enum Pending::EKind;
+
+        // one per pending group, innermost last
+        struct PendingGroup {
+            ExprGroup group;
+            // the rule a memoized group is remembered as once complete
+            Opt<ERule> rule{};
+            TokenStream::Position begin{};
+            szt collected{};
+        };
+
+        Vec<Pending> pending;
+        Vec<PendingGroup> groups;
+        auto level = minP;
+        auto location = m_stream.peek().location();
+
+        // the next operand is the first one of an element or of a try
+        auto const enter = [&] {
+            level = 0;
+            location = m_stream.peek().location();
+        };
+
+        // pops the innermost group once complete
+        auto const popGroup = [&](ParseResult group) -> ParseResult {
+            if (auto const& entry = groups.back(); entry.rule) {
+                remember(*entry.rule, entry.begin, entry.collected, group);
+            }
+            groups.pop_back();
+            auto entry = std::move(pending.back());
+            pending.pop_back();
+
+            level = entry.minP;
+            location = entry.location;
+            if (!group || entry.kind == Group) {
+                return group;
+            }
+            return entry.kind == Arguments
+                ? syntax::Node{syntax::expr::FnApp{
+                    std::move(entry.lhs), std::move(*group), entry.location
+                }}
+                : syntax::Node{syntax::expr::Subscript{
+                    std::move(entry.lhs), std::move(*group), entry.location
+                }};
+        };
+
+        // returns the group if it is complete as soon as it is opened
+        auto const pushGroup = [&](
+            Pending::EKind const kind, EGroup const group,
+            Opt<ERule> const rule, syntax::Node lhs
+        ) -> Opt<ParseResult> {
+            pending.push_back({kind, lexeme::empty, level, location, std::move(lhs)});
+            auto& entry = groups.emplace_back(ExprGroup{group});
+            if (rule && m_memo.enabled(*rule)) {
+                if (auto recalled = recall(*rule)) {
+                    return popGroup(*std::move(recalled));
+                }
+                entry.rule = rule;
+                entry.begin = m_stream.position();
+                entry.collected = TErrorCollector::instance().threadSize();
+            }
+
+            if (auto opened = openGroup(entry.group)) {
+                return popGroup(*std::move(opened));
+            }
+            enter();
+            return std::nullopt;
+        };
+
+        while (true) {
+            while (m_stream.match(syntax::isPrefixOperator)) {
+                auto const op = m_stream.current().lexeme();
+                pending.push_back({Prefix, op, level, location});
+                level = syntax::opPrecedence(op, syntax::EOperator::Prefix);
+                location = m_stream.peek().location();
+            }
+
+            Opt<ParseResult> operand;
+            switch (firstOf(primaryExprFirstSet, m_stream.peek().lexeme())) {
+            case EPrimaryExpr::Try:
+                m_stream.advance();
+                pending.push_back({Try, lexeme::empty, level, location});
+                enter();
+                continue;
+            case EPrimaryExpr::Literal:
+                operand = handleSingleTokenLiteral();
+                break;
+            case EPrimaryExpr::Path:
+                if (!startsRecord()) {
+                    operand = handleIdentifierLiteral();
+                    break;
+                }
+                [[fallthrough]];
+            case EPrimaryExpr::Record:
+                operand = pushGroup(Group, EGroup::Record, ERule::RecordExpr, {});
+                break;
+            case EPrimaryExpr::String:
+                operand = handleString();
+                break;
+            case EPrimaryExpr::Tuple:
+                operand = pushGroup(Group, EGroup::Tuple, ERule::TupleExpr, {});
+                break;
+            case EPrimaryExpr::Array:
+                operand = pushGroup(Group, EGroup::Array, std::nullopt, {});
+                break;
+            default:
+                operand = defaultError();
+                break;
+            }
+            if (!operand) {
+                // the first element of the group just opened is next
+                continue;
+            }
+
+            // applies the operators that follow the operand until one
+            // starts a new operand
+            auto result = *std::move(operand);
+            while (true) {
+                if (!result) {
+                    // the expression the failed operand belongs to fails
+                    // up to the innermost try or group, which collects it
+                    while (!pending.empty() &&
+                        (pending.back().kind == Prefix ||
+                            pending.back().kind == Binary)) {
+                        pending.pop_back();
+                    }
+                    if (pending.empty()) {
+                        return result;
+                    }
+
+                    if (pending.back().kind == Try) {
+                        collect(result.error()).collect({
+                            .location = m_tracker.current(),
+                            .context = EParseErrorContext::TryExpr,
+                            .reason = EParseErrorReason::MissingExpr,
+                        });
+                        auto const entry = std::move(pending.back());
+                        pending.pop_back();
+                        result = syntax::expr::Try{
+                            syntax::RequiredButMissing{}, entry.location
+                        };
+                        level = entry.minP;
+                        location = entry.location;
+                    }
+                    else if (endElement(groups.back().group, std::move(result))) {
+                        enter();
+                        break;
+                    }
+                    else {
+                        result = popGroup(closeGroup(groups.back().group));
+                        continue;
+                    }
+                }
+
+                auto const op = m_stream.peek().lexeme();
+                if (syntax::isPostfixStart(op)) {
+                    auto const arguments = op == lexeme::leftParen;
+                    auto group = pushGroup(
+                        arguments ? Arguments : Subscript,
+                        arguments ? EGroup::Tuple : EGroup::Array,
+                        std::nullopt, std::move(*result)
+                    );
+                    if (!group) {
+                        break;
+                    }
+                    result = *std::move(group);
+                }
+                // 0 unless {op} is a binary operator
+                else if (auto const p = syntax::opPrecedence(
+                        op, syntax::EOperator::Binary
+                    ); p > level) {
+                    m_stream.advance();
+                    pending.push_back({Binary, op, level, location, std::move(*result)});
+                    level = syntax::isLeftAssociative(op) ? p + 1 : p;
+                    location = m_stream.peek().location();
+                    break;
+                }
+                else if (pending.empty()) {
+                    return result;
+                }
+                else if (auto const kind = pending.back().kind;
+                    kind == Prefix || kind == Binary || kind == Try) {
+                    // {result} was the last operand of the innermost
+                    // operator or try
+                    auto entry = std::move(pending.back());
+                    pending.pop_back();
+                    result = kind == Prefix
+                        ? syntax::Node{syntax::expr::Prefix{
+                            std::move(*result), entry.op, entry.location
+                        }}
+                        : kind == Binary
+                        ? syntax::Node{syntax::expr::Binary{
+                            std::move(entry.lhs), std::move(*result), entry.op,
+                            entry.location
+                        }}
+                        : syntax::Node{syntax::expr::Try{
+                            std::move(*result), entry.location
+                        }};
+                    level = entry.minP;
+                    location = entry.location;
+                }
+                // {result} was an element of the innermost group
+                else if (endElement(groups.back().group, std::move(result))) {
+                    enter();
+                    break;
+                }
+                else {
+                    result = popGroup(closeGroup(groups.back().group));
+                }
+            }
+        }
+    }
+
+    auto Parse::handleRecursiveExpr(syntax::OpPrecedence const minP) // NOLINT(*-no-recursion)
+        -> ParseResult {
         TLC_SCOPE_REPORTER();
         auto const location = m_tracker.scopedLocation();
         ParseResult lhs;
@@ -12,7 +277,7 @@ namespace tlc::parse {
         // to avoid ambiguity
         if (m_stream.match(syntax::isPrefixOperator)) {
             auto const op = m_stream.current().lexeme();
-            lhs = handleExpr(
+            lhs = handleRecursiveExpr(
                     syntax::opPrecedence(
                         op, syntax::EOperator::Prefix
                     ))
@@ -27,8 +292,6 @@ namespace tlc::parse {
             return Unexpected{lhs.error()};
         }
 
-        // m_stream.markBacktrack();
-        auto streamBacktrack = m_stream.scopedBacktrack();
         while (true) {
             if (syntax::isPostfixStart(m_stream.peek().lexeme())) {
                 if (auto const tuple = handleTupleExpr(); tuple) {
@@ -42,18 +305,19 @@ namespace tlc::parse {
                     };
                 }
             }
-            else if (m_stream.match(syntax::isBinaryOperator)) {
-                auto const op = m_stream.current().lexeme();
+            else if (auto const op = m_stream.peek().lexeme();
+                syntax::isBinaryOperator(op)) {
                 auto const p = syntax::opPrecedence(
                     op, syntax::EOperator::Binary
                 );
 
+                // left for the caller that owns the lower precedence
                 if (p <= minP) {
-                    streamBacktrack();
                     break;
                 }
 
-                lhs = handleExpr(
+                m_stream.advance();
+                lhs = handleRecursiveExpr(
                     syntax::isLeftAssociative(op) ? p + 1 : p
                 ).and_then([&](auto const& rhs) -> ParseResult {
                     return syntax::expr::Binary{
@@ -71,38 +335,35 @@ namespace tlc::parse {
 
     auto Parse::handlePrimaryExpr() -> ParseResult { // NOLINT(*-no-recursion)
         TLC_SCOPE_REPORTER();
-        // todo:
-        if (auto const result = handleTryExpr(); result) {
-            return result;
-        }
-        if (auto const result = handleSingleTokenLiteral(); result) {
-            return result;
-        }
-        if (auto const result = handleRecordExpr(); result) {
-            return result;
-        }
-        if (auto const result = handleIdentifierLiteral(); result) {
-            return result;
-        }
-        if (auto const result = handleString(); result) {
-            return result;
-        }
-        if (auto const result = handleTupleExpr(); result) {
-            return result;
-        }
-        if (auto const result = handleArrayExpr(); result) {
-            return result;
+        switch (firstOf(primaryExprFirstSet, m_stream.peek().lexeme())) {
+        case EPrimaryExpr::Try:
+            return handleTryExpr();
+        case EPrimaryExpr::Literal:
+            return handleSingleTokenLiteral();
+        case EPrimaryExpr::Path:
+            if (!startsRecord()) {
+                return handleIdentifierLiteral();
+            }
+            [[fallthrough]];
+        case EPrimaryExpr::Record:
+            return memoized(ERule::RecordExpr, [this] {
+                return handleRecordExpr();
+            });
+        case EPrimaryExpr::String:
+            return handleString();
+        case EPrimaryExpr::Tuple:
+            return memoized(ERule::TupleExpr, [this] {
+                return handleTupleExpr();
+            });
+        case EPrimaryExpr::Array:
+            return handleArrayExpr();
+        default:
+            return defaultError();
         }
-        return defaultError();
     }
 
     auto Parse::handleSingleTokenLiteral() -> ParseResult {
         TLC_SCOPE_REPORTER();
-        static const HashMap<lexeme::Lexeme, i32> baseTable = {
-            {lexeme::integer2Literal, 2}, {lexeme::integer8Literal, 8},
-            {lexeme::integer10Literal, 10}, {lexeme::integer16Literal, 16},
-        };
-
         return match(
             lexeme::integer2Literal, lexeme::integer8Literal,
             lexeme::integer10Literal, lexeme::integer16Literal,
@@ -110,26 +371,29 @@ namespace tlc::parse {
         )(m_stream, m_tracker).and_then(
             [this](const auto& tokens)
             -> ParseResult {
-                auto location = tokens.front().location();
-                switch (tokens.front().lexeme().type()) {
-                case lexeme::Lexeme::FloatLiteral:
-                    return syntax::expr::Float{
-                        std::stod(tokens.front().str()), location
-                    };
-                case lexeme::Lexeme::True:
-                case lexeme::Lexeme::False:
+                auto const& token = tokens.front();
+                auto location = token.location();
+                if (token.lexeme() == lexeme::true_ ||
+                    token.lexeme() == lexeme::false_) {
                     return syntax::expr::Boolean{
-                        tokens.front().lexeme() == lexeme::true_, location
-                    };
-                default:
-                    return syntax::expr::Integer{
-                        std::stoll(
-                            tokens.front().str(), nullptr,
-                            baseTable.at(tokens.front().lexeme())
-                        ),
-                        location
+                        token.lexeme() == lexeme::true_, location
                     };
                 }
+
+                // the lexer already converted the literal
+                if (auto const value = std::get_if<f64>(&token.value())) {
+                    return syntax::expr::Float{*value, location};
+                }
+                if (auto const value = std::get_if<i64>(&token.value())) {
+                    return syntax::expr::Integer{*value, location};
+                }
+
+                collect({
+                    .location = location,
+                    .context = EParseErrorContext::NumericLiteral,
+                    .reason = EParseErrorReason::OutOfRange,
+                });
+                return syntax::RequiredButMissing{};
             }
         );
     }
@@ -138,24 +402,24 @@ namespace tlc::parse {
         TLC_SCOPE_REPORTER();
         if (m_stream.match(lexeme::anonymous)) {
             return syntax::expr::Identifier{
-                {m_stream.current().str()}, m_stream.current().location()
+                {m_stream.current().symbol()}, m_stream.current().location()
             };
         }
+        using combinator::match, combinator::many0, combinator::seq;
         return seq(
             many0(seq(match(lexeme::identifier), match(lexeme::dot))),
             match(lexeme::identifier)
-        )(m_stream, m_tracker).and_then([this](auto const& tokens)
+        )(m_stream, m_tracker).and_then([this](TokenRange const tokens)
             -> ParseResult {
-                auto path = tokens
-                    | rv::take(tokens.size() - 1)
-                    | rv::filter([](auto&& token) {
-                        return token.lexeme() == lexeme::identifier;
-                    })
-                    | rv::transform([](auto&& token) { return token.str(); })
-                    | rng::to<Vec<Str>>();
-                path.push_back(Str{tokens.back().str()});
+                // identifiers and dots alternate, starting and ending with
+                // an identifier
+                syntax::Path path;
+                path.reserve(tokens.size() / 2 + 1);
+                for (auto index = tokens.begin; index < tokens.end; index += 2) {
+                    path.push_back(m_stream.at(index).symbol());
+                }
                 return syntax::expr::Identifier{
-                    std::move(path), tokens.front().location()
+                    std::move(path), m_stream.at(tokens.begin).location()
                 };
             }
         );
@@ -163,180 +427,209 @@ namespace tlc::parse {
 
     auto Parse::handleTupleExpr() -> ParseResult { // NOLINT(*-no-recursion)
         TLC_SCOPE_REPORTER();
-        auto const location = m_tracker.scopedLocation();
-        if (!m_stream.match(lexeme::leftParen)) {
-            return defaultError();
-        }
-        if (m_stream.match(lexeme::rightParen)) {
-            return syntax::expr::Tuple{{}, *location};
-        }
+        ExprGroup group{EGroup::Tuple};
+        return handleGroupExpr(group);
+    }
 
-        Vec<syntax::Node> elements;
-        do {
-            /**
-             * (x,y,z,) -> error, the ',' after 'z' expects another expr
-             * (,x,y,z) -> error, the ',' before 'x' expects another expr
-             * (,x,y,z,) -> error
-             * (Int,x,y) -> error, "Int" is not an expr
-             *
-             */
-            elements.push_back(*handleExpr().or_else(
-                    [this](auto&& error) -> ParseResult {
-                        collect(error).collect({
-                            .location = m_tracker.current(),
-                            .context = EParseErrorContext::Tuple,
-                            .reason = EParseErrorReason::MissingExpr,
-                        });
-                        return syntax::RequiredButMissing{};
-                    })
-            );
-        }
-        while (m_stream.match(lexeme::comma));
+    auto Parse::handleArrayExpr() -> ParseResult { // NOLINT(*-no-recursion)
+        TLC_SCOPE_REPORTER();
+        ExprGroup group{EGroup::Array};
+        return handleGroupExpr(group);
+    }
 
-        if (!m_stream.match(lexeme::rightParen)) {
-            collect({
-                .location = m_tracker.current(),
-                .context = EParseErrorContext::Tuple,
-                .reason = EParseErrorReason::MissingEnclosingSymbol,
-            });
+    auto Parse::startsRecord() -> b8 {
+        szt distance = m_stream.peek().lexeme() == lexeme::dollar ? 1 : 0;
+        while (m_stream.lookahead(distance) == lexeme::identifier &&
+            m_stream.lookahead(distance + 1) == lexeme::dot) {
+            distance += 2;
         }
 
-        return syntax::expr::Tuple{std::move(elements), *location};
+        auto const last = m_stream.lookahead(distance);
+        return (last == lexeme::userDefinedType ||
+                last == lexeme::fundamentalType) &&
+            m_stream.lookahead(distance + 1) == lexeme::leftBrace;
     }
 
-    auto Parse::handleArrayExpr() -> ParseResult { // NOLINT(*-no-recursion)
+    auto Parse::handleRecordExpr() -> ParseResult { // NOLINT(*-no-recursion)
         TLC_SCOPE_REPORTER();
-        auto const location = m_tracker.scopedLocation();
-        if (!m_stream.match(lexeme::leftBracket)) {
+        // only reached when startsRecord() or '{' is ahead
+        ExprGroup group{EGroup::Record};
+        return handleGroupExpr(group);
+    }
+
+    auto Parse::handleGroupExpr(ExprGroup& group) -> ParseResult { // NOLINT(*-no-recursion)
+        if (auto opened = openGroup(group)) {
+            return *std::move(opened);
+        }
+        while (endElement(group, handleExpr())) {}
+        return closeGroup(group);
+    }
+
+    auto Parse::openGroup(ExprGroup& group) -> Opt<ParseResult> {
+        group.location = m_stream.peek().location();
+        if (group.kind == EGroup::Record &&
+            m_stream.peek().lexeme() != lexeme::leftBrace) {
+            group.type = handleTypeIdentifier().value_or({});
+        }
+
+        if (!m_stream.match(group.opening())) {
             return defaultError();
         }
-        if (m_stream.match(lexeme::rightBracket)) {
-            return syntax::expr::Array{{}, *location};
+        if (m_stream.peek().lexeme() == group.closing()) {
+            return closeGroup(group);
         }
 
-        Vec<syntax::Node> elements;
-        do {
-            /**
-             * [x,y,z,] -> error, the ',' after 'z' expects another expr
-             * [,x,y,z] -> error, the ',' before 'x' expects another expr
-             * [,x,y,z,] -> error
-             * [Int,x,y] -> error, "Int" is not an expr
-             *
-             */
-            elements.push_back(*handleExpr().or_else(
-                    [this](auto&& error) -> ParseResult {
-                        collect(error);
-                        collect({
-                            .location = m_tracker.current(),
-                            .context = EParseErrorContext::Array,
-                            .reason = EParseErrorReason::MissingExpr,
-                        });
-                        return syntax::RequiredButMissing{};
-                    })
-            );
+        beginElement(group);
+        return std::nullopt;
+    }
+
+    auto Parse::beginElement(ExprGroup& group) -> void {
+        if (group.kind != EGroup::Record) {
+            return;
         }
-        while (m_stream.match(lexeme::comma));
 
-        if (!m_stream.match(lexeme::rightBracket)) {
+        group.entryLocation = m_stream.peek().location();
+        group.key = {};
+        if (!m_stream.match(lexeme::identifier)) {
             collect({
                 .location = m_tracker.current(),
-                .context = EParseErrorContext::Array,
-                .reason = EParseErrorReason::MissingEnclosingSymbol,
+                .context = EParseErrorContext::Record,
+                .reason = EParseErrorReason::MissingId,
             });
         }
-
-        return syntax::expr::Array{std::move(elements), *location};
-    }
-
-    auto Parse::handleRecordExpr() -> ParseResult { // NOLINT(*-no-recursion)
-        TLC_SCOPE_REPORTER();
-        auto streamBacktrack = m_stream.scopedBacktrack();
-        auto const location = m_tracker.scopedLocation();
-
-        auto type = handleTypeIdentifier().value_or({});
-        if (!m_stream.match(lexeme::leftBrace)) {
-            streamBacktrack();
-            return defaultError();
+        else {
+            group.key = m_stream.current().symbol();
         }
-        if (m_stream.match(lexeme::rightBrace)) {
-            return syntax::expr::Record{
-                std::move(type), {}, *location
-            };
+
+        if (!m_stream.match(lexeme::colon)) {
+            collect({
+                .location = m_tracker.current(),
+                .context = EParseErrorContext::Record,
+                .reason = EParseErrorReason::MissingSymbol,
+            });
         }
+    }
 
-        Vec<syntax::Node> entries;
-        do {
-            auto entryLocation = m_tracker.scopedLocation();
-            Str key;
-            if (!m_stream.match(lexeme::identifier)) {
-                collect({
+    auto Parse::endElement(ExprGroup& group, ParseResult element) -> b8 {
+        /**
+         * (x,y,z,) -> error, the ',' after 'z' expects another expr
+         * (,x,y,z) -> error, the ',' before 'x' expects another expr
+         * (,x,y,z,) -> error
+         * (Int,x,y) -> error, "Int" is not an expr
+         *
+         * and likewise for arrays and the values of records
+         */
+        auto node = *std::move(element).or_else([&](auto&& error) -> ParseResult {
+            switch (group.kind) {
+            case EGroup::Tuple:
+                collect(error).collect({
                     .location = m_tracker.current(),
-                    .context = EParseErrorContext::Record,
-                    .reason = EParseErrorReason::MissingId,
+                    .context = EParseErrorContext::Tuple,
+                    .reason = EParseErrorReason::MissingExpr,
                 });
-            }
-            else {
-                key = m_stream.current().str();
-            }
-
-            if (!m_stream.match(lexeme::colon)) {
+                return syntax::RequiredButMissing{};
+            case EGroup::Array:
+                collect(error);
                 collect({
+                    .location = m_tracker.current(),
+                    .context = EParseErrorContext::Array,
+                    .reason = EParseErrorReason::MissingExpr,
+                });
+                return syntax::RequiredButMissing{};
+            default:
+                collect(error).collect({
                     .location = m_tracker.current(),
                     .context = EParseErrorContext::Record,
-                    .reason = EParseErrorReason::MissingSymbol,
+                    .reason = EParseErrorReason::MissingExpr,
                 });
+                return {};
             }
+        });
 
-            syntax::Node value = *handleExpr().or_else(
-                [this](auto&& error) -> ParseResult {
-                    collect(error).collect({
-                        .location = m_tracker.current(),
-                        .context = EParseErrorContext::Record,
-                        .reason = EParseErrorReason::MissingExpr,
-                    });
-                    return {};
-                }
-            );
-
-            entries.emplace_back(syntax::expr::RecordEntry{
-                std::move(key), std::move(value), *entryLocation
+        if (group.kind == EGroup::Record) {
+            group.elements.emplace_back(syntax::expr::RecordEntry{
+                group.key, std::move(node), group.entryLocation
             });
         }
-        while (m_stream.match(lexeme::comma));
+        else {
+            group.elements.push_back(std::move(node));
+        }
 
-        if (!m_stream.match(lexeme::rightBrace)) {
+        if (!m_stream.match(lexeme::comma)) {
+            return false;
+        }
+        beginElement(group);
+        return true;
+    }
+
+    auto Parse::closeGroup(ExprGroup& group) -> syntax::Node {
+        if (!m_stream.match(group.closing())) {
             collect({
                 .location = m_tracker.current(),
-                .context = EParseErrorContext::Record,
+                .context = group.kind == EGroup::Tuple ? EParseErrorContext::Tuple :
+                    group.kind == EGroup::Array ? EParseErrorContext::Array :
+                    EParseErrorContext::Record,
                 .reason = EParseErrorReason::MissingEnclosingSymbol,
             });
         }
 
-        return syntax::expr::Record{
-            std::move(type), std::move(entries), *location
-        };
+        switch (group.kind) {
+        case EGroup::Tuple:
+            return syntax::expr::Tuple{std::move(group.elements), group.location};
+        case EGroup::Array:
+            return syntax::expr::Array{std::move(group.elements), group.location};
+        default:
+            return syntax::expr::Record{
+                std::move(group.type), std::move(group.elements), group.location
+            };
+        }
     }
 
     auto Parse::handleString() -> ParseResult {
         TLC_SCOPE_REPORTER();
-        return seq(
-            match(lexeme::stringFragment),
-            many0(seq(
-                match(lexeme::stringPlaceholder),
-                match(lexeme::stringFragment)
-            ))
-        )(m_stream, m_tracker).and_then(
-            [this](auto const& tokens) -> ParseResult {
-                auto location = tokens.front().location();
+        using combinator::match;
+        return match(lexeme::stringFragment)(m_stream, m_tracker).and_then(
+            [this](TokenRange const first) -> ParseResult {
+                auto const location = m_stream.at(first.begin).location();
+                Vec<Str> fragments{Str{m_stream.at(first.begin).str()}};
+                Vec<syntax::Node> placeholders{};
+
+                // the lexer emits the tokens of a placeholder between its
+                // markers and always follows the end marker with a fragment
+                auto const nested = m_inPlaceholder;
+                while (match(lexeme::placeholderBegin)(m_stream, m_tracker)) {
+                    m_inPlaceholder = true;
+                    placeholders.push_back(
+                        *handleExpr().or_else([&](auto&& error) -> ParseResult {
+                            collect(error).collect({
+                                .location = m_tracker.current(),
+                                .context = EParseErrorContext::String,
+                                .reason = EParseErrorReason::MissingExpr,
+                            });
+                            return {};
+                        })
+                    );
+                    m_inPlaceholder = nested;
 
-                if (tokens.size() == 1) {
-                    return syntax::expr::String{
-                        {tokens.front().str()}, {}, location
-                    };
+                    if (!match(lexeme::placeholderEnd)(m_stream, m_tracker)) {
+                        collect({
+                            .location = m_tracker.current(),
+                            .context = EParseErrorContext::String,
+                            .reason = EParseErrorReason::MissingEnclosingSymbol,
+                        });
+                        skipPlaceholder();
+                    }
+
+                    auto const fragment =
+                        match(lexeme::stringFragment)(m_stream, m_tracker);
+                    if (!fragment) {
+                        break;
+                    }
+                    fragments.emplace_back(m_stream.at(fragment->begin).str());
                 }
 
                 // prohibit recursive string interpolation
-                if (m_isSubroutine) {
+                if (nested && !placeholders.empty()) {
                     return error({
                         .location = m_tracker.current(),
                         .context = EParseErrorContext::String,
@@ -344,37 +637,6 @@ namespace tlc::parse {
                     });
                 }
 
-                Vec<Str> fragments = tokens | rv::enumerate
-                    | rv::filter([](Pair<szt, token::Token> const& entry) {
-                        return (entry.first & 1) == 0;
-                    }) | rv::transform([](Pair<szt, token::Token> const& entry) {
-                        return entry.second.str();
-                    }) | rng::to<Vec<Str>>();
-
-                Vec<syntax::Node> placeholders = tokens | rv::enumerate
-                    | rv::filter([](Pair<szt, token::Token> const& entry) {
-                        return entry.first & 1;
-                    }) | rv::transform([this, location, &tokens](
-                        Pair<szt, token::Token> const& entry) {
-                            std::istringstream iss;
-                            iss.str(entry.second.str());
-                            return *Parse{
-                                m_filepath, lex::Lex::operator()(std::move(iss)),
-                                Location{
-                                    .line = tokens[entry.first].location().line,
-                                    .column = tokens[entry.first].location().column -
-                                    location.column + 1
-                                }
-                            }.handleExpr().or_else([&](auto&& error) -> ParseResult {
-                                collect(error).collect({
-                                    .location = m_tracker.current(),
-                                    .context = EParseErrorContext::String,
-                                    .reason = EParseErrorReason::MissingExpr,
-                                });
-                                return {};
-                            });
-                        }) | rng::to<Vec<syntax::Node>>();
-
                 return syntax::expr::String{
                     std::move(fragments), std::move(placeholders), location
                 };
@@ -382,6 +644,24 @@ namespace tlc::parse {
         );
     }
 
+    auto Parse::skipPlaceholder() -> void {
+        szt depth = 0;
+        while (!m_stream.done()) {
+            if (m_stream.match(lexeme::placeholderBegin)) {
+                ++depth;
+            }
+            else if (m_stream.match(lexeme::placeholderEnd)) {
+                if (depth == 0) {
+                    return;
+                }
+                --depth;
+            }
+            else {
+                m_stream.advance();
+            }
+        }
+    }
+
     auto Parse::handleTryExpr() -> ParseResult {
         return match(lexeme::try_)(m_stream, m_tracker).and_then(
             [this](auto const& tokens) -> ParseResult {
@@ -1,7 +1,7 @@
 #include "parse.hpp"
 
 namespace tlc::parse {
-    auto Parse::handleFunctionDef(token::Token const& visibility) -> ParseResult {
+    auto Parse::handleFunctionDef(token::TokenView const visibility) -> ParseResult {
         return handleFunctionPrototype().and_then(
             [this, &visibility](syntax::Node&& prototype) -> ParseResult {
                 auto body = handleBlockStmt();
@@ -26,9 +26,9 @@ namespace tlc::parse {
 
         auto location = m_tracker.current();
         auto genericDecl = handleGenericParamsDecl().value_or({});
-        Str name;
+        Symbol name;
         if (m_stream.match(lexeme::identifier)) {
-            name = m_stream.current().str();
+            name = m_stream.current().symbol();
         }
         else {
             collect({
@@ -74,7 +74,7 @@ namespace tlc::parse {
             });
 
         return syntax::global::FunctionPrototype{
-            std::move(genericDecl), std::move(name), std::move(paramsDecl),
+            std::move(genericDecl), name, std::move(paramsDecl),
             std::move(returnsDecl), std::move(location)
         };
     }
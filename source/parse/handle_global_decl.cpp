@@ -4,15 +4,25 @@ namespace tlc::parse {
     auto Parse::handleTranslationUnit() -> ParseResult {
         auto moduleDecl = handleModuleDecl();
         if (!moduleDecl) {
-            return error({
-                .context = EParseErrorContext::TranslationUnit,
-                .reason = EParseErrorReason::MissingDecl,
-            });
+            return missingModuleDecl();
         }
 
+        auto importGroup = handleImportDeclGroup();
+
+        Vec<syntax::Node> definitions;
+        handleDefinitions([&](syntax::Node definition) {
+            definitions.push_back(std::move(definition));
+        });
+
+        return syntax::TranslationUnit{
+            m_file, std::move(*moduleDecl),
+            std::move(importGroup), std::move(definitions)
+        };
+    }
+
+    auto Parse::handleImportDeclGroup() -> syntax::Node {
         Vec<syntax::Node> imports;
-        Location importGroupLocation = m_tracker.push();
-        syntax::Node importGroup;
+        SourceLocation importGroupLocation = m_tracker.push();
         while (m_stream.peek().lexeme() != lexeme::invalid) {
             auto importDecl = handleImportDecl();
             if (!importDecl) {
@@ -21,14 +31,15 @@ namespace tlc::parse {
             }
             imports.push_back(std::move(*importDecl));
         }
-        if (!imports.empty()) {
-            importGroup = syntax::global::ImportDeclGroup{
-                std::move(imports), std::move(importGroupLocation)
-            };
+        if (imports.empty()) {
+            return {};
         }
+        return syntax::global::ImportDeclGroup{
+            std::move(imports), std::move(importGroupLocation)
+        };
+    }
 
-
-        Vec<syntax::Node> definitions;
+    auto Parse::handleDefinitions(Fn<void(syntax::Node)> const& emit) -> void {
         while (m_stream.peek().lexeme() != lexeme::invalid) {
             auto const visibility =
                 m_stream.match(lexeme::pub, lexeme::prv)
@@ -36,14 +47,9 @@ namespace tlc::parse {
                     : createDefaultVisibility();
 
             if (auto fnDef = handleFunctionDef(visibility); fnDef) {
-                definitions.push_back(std::move(*fnDef));
+                emit(std::move(*fnDef));
             }
         }
-
-        return syntax::TranslationUnit{
-            m_filepath, std::move(*moduleDecl),
-            std::move(importGroup), std::move(definitions)
-        };
     }
 
     auto Parse::handleModuleDecl() -> ParseResult {
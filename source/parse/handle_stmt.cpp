@@ -3,24 +3,31 @@
 namespace tlc::parse {
     auto Parse::handleStmt() -> ParseResult {
         TLC_SCOPE_REPORTER();
-        if (auto returnStmt = handleReturnStmt(); returnStmt) {
-            return returnStmt;
-        }
-        if (auto deferStmt = handleDeferStmt(); deferStmt) {
-            return deferStmt;
-        }
-        if (auto blockStmt = handleBlockStmt(); blockStmt) {
-            return blockStmt;
-        }
-        if (auto matchStmt = handleMatchStmt(); matchStmt) {
-            return matchStmt;
-        }
-        if (auto loopStmt = handleLoopStmt(); loopStmt) {
-            return loopStmt;
-        }
-        if (auto declStmt = handleDeclStmt(); declStmt) {
-            return declStmt;
+        switch (firstOf(stmtFirstSet, m_stream.peek().lexeme())) {
+        case EStmt::Return:
+            return handleReturnStmt();
+        case EStmt::Defer:
+            return handleDeferStmt();
+        case EStmt::Block:
+            return handleBlockStmt();
+        case EStmt::Match:
+            return handleMatchStmt();
+        case EStmt::Loop:
+            return handleLoopStmt();
+        case EStmt::Decl:
+            if (!startsDeclStmt()) {
+                break;
+            }
+            if (auto declStmt = memoized(ERule::DeclStmt, [this] {
+                return handleDeclStmt();
+            }); declStmt) {
+                return declStmt;
+            }
+            break;
+        default:
+            break;
         }
+
         if (auto exprStmt = handleExprPrefixedStmt(); exprStmt) {
             return exprStmt;
         }
@@ -29,6 +36,16 @@ namespace tlc::parse {
         return {};
     }
 
+    auto Parse::startsDeclStmt() -> b8 {
+        // a tuple declaration and a parenthesized expression share their
+        // first token, only the '=' after the whole tuple tells them apart
+        if (m_stream.peek().lexeme() == lexeme::leftParen) {
+            return true;
+        }
+        auto const next = m_stream.lookahead(1);
+        return next == lexeme::equal || next == lexeme::colon;
+    }
+
     auto Parse::handleDeclStmt() -> ParseResult {
         TLC_SCOPE_REPORTER();
         auto const location = m_tracker.scopedLocation();
@@ -1,7 +1,7 @@
 #include "parse.hpp"
 
 namespace tlc::parse {
-    auto Parse::handleTraitDef([[maybe_unused]] token::Token const& visibility) -> ParseResult {
+    auto Parse::handleTraitDef([[maybe_unused]] token::TokenView const visibility) -> ParseResult {
         return {};
     }
 }
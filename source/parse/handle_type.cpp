@@ -5,19 +5,19 @@ namespace tlc::parse {
         TLC_SCOPE_REPORTER();
         auto const location = m_tracker.scopedLocation();
         auto lhs = [this] {
-            if (auto infer = handleTypeInfer(); infer) {
-                return infer;
+            switch (firstOf(typeFirstSet, m_stream.peek().lexeme())) {
+            case EPrimaryType::Infer:
+                return handleTypeInfer();
+            case EPrimaryType::Tuple:
+                return handleTypeTuple();
+            default:
+                return handleTypeIdentifier();
             }
-            if (auto tuple = handleTypeTuple(); tuple) {
-                return tuple;
-            }
-            return handleTypeIdentifier();
         }();
         if (!lhs) {
             return defaultError();
         }
 
-        auto streamBacktrack = m_stream.scopedBacktrack();
         while (true) {
             if (auto array = handleArrayExpr(); array) {
                 lhs = syntax::type::Array{
@@ -43,17 +43,18 @@ namespace tlc::parse {
                 };
                 continue;
             }
-            if (m_stream.match(syntax::isBinaryTypeOperator)) {
-                auto const op = m_stream.current().lexeme();
+            if (auto const op = m_stream.peek().lexeme();
+                syntax::isBinaryTypeOperator(op)) {
                 auto const p = syntax::opPrecedence(
                     op, syntax::EOperator::Binary
                 );
 
                 if (p <= minP) {
-                    streamBacktrack();
                     break;
                 }
 
+                m_stream.advance();
+
                 lhs = handleType(
                     syntax::isLeftAssociative(op) ? p + 1 : p
                 ).and_then([&](auto const& rhs) -> ParseResult {
@@ -78,14 +79,13 @@ namespace tlc::parse {
             match(lexeme::fundamentalType, lexeme::userDefinedType)
         )(m_stream, m_tracker).and_then(
             [&](auto const& tokens) -> ParseResult {
-                auto path = tokens
-                    | rv::take(tokens.size() - 1)
-                    | rv::filter([](auto&& token) {
-                        return token.lexeme() == lexeme::identifier;
-                    })
-                    | rv::transform([](auto&& token) { return token.str(); })
-                    | rng::to<Vec<Str>>();
-                path.push_back(Str{tokens.back().str()});
+                syntax::Path path;
+                for (auto const& token : tokens | rv::take(tokens.size() - 1)) {
+                    if (token.lexeme() == lexeme::identifier) {
+                        path.push_back(token.symbol());
+                    }
+                }
+                path.push_back(tokens.back().symbol());
                 return syntax::type::Identifier{
                     constant, std::move(path),
                     m_stream.current().lexeme() == lexeme::fundamentalType,
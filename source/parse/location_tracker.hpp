@@ -14,24 +14,24 @@ namespace tlc::parse {
 
         auto scopedLocation() noexcept -> ScopedLocation;
 
-        auto push() -> Location {
+        auto push() -> SourceLocation {
             auto const next = m_stream.peek().location();
             m_locations.push(m_stream.peek().location());
             return next;
         }
 
-        auto top() -> Location {
+        auto top() -> SourceLocation {
             if (m_locations.empty()) {
                 exitOnInternalError("m_locations.empty()");
             }
             return m_locations.top();
         }
 
-        auto current() const -> Location {
+        auto current() const -> SourceLocation {
             return m_stream.current().location();
         }
 
-        auto pop() -> Location {
+        auto pop() -> SourceLocation {
             auto const top = m_locations.top();
             m_locations.pop();
             return top;
@@ -39,7 +39,7 @@ namespace tlc::parse {
 
     private:
         TokenStream const& m_stream;
-        Stack<Location> m_locations{};
+        Stack<SourceLocation> m_locations{};
     };
 
     class ScopedLocation {
@@ -56,13 +56,13 @@ namespace tlc::parse {
         ScopedLocation(ScopedLocation const&) = delete;
         ScopedLocation& operator=(ScopedLocation const&) = delete;
 
-        auto operator*() const noexcept -> Location {
+        auto operator*() const noexcept -> SourceLocation {
             return m_location;
         }
 
     private:
         LocationTracker& m_tracker;
-        Location m_location;
+        SourceLocation m_location;
     };
 
     inline auto LocationTracker::scopedLocation() noexcept -> ScopedLocation {
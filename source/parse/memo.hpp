@@ -0,0 +1,86 @@
+#ifndef TLC_PARSE_MEMO_HPP
+#define TLC_PARSE_MEMO_HPP
+
+#include "core/core.hpp"
+#include "syntax/syntax.hpp"
+
+#include "parse_error.hpp"
+#include "token_stream.hpp"
+
+namespace tlc::parse {
+    // rules that can be attempted again at a token they have already been
+    // parsed at, once the stream backtracks over it
+    enum class ERule : u8 {
+        DeclStmt, TupleDecl, TupleExpr, RecordExpr,
+    };
+
+    /**
+     * Packrat table from a rule and the position it started at to what
+     * parsing it there produced: its result, the position it left the stream
+     * at and the errors it collected. Repeating the rule at that position is
+     * a lookup instead of a re-parse. Rules are only memoized once enabled,
+     * since recording costs more than parsing them for rules that are never
+     * repeated.
+     */
+    class Memo final {
+        using TError = Error<EParseErrorContext, EParseErrorReason>;
+        using ParseResult = Expected<syntax::Node, TError>;
+
+    public:
+        struct Entry {
+            ParseResult result;
+            TokenStream::Position end;
+            Vec<TError> errors;
+        };
+
+        auto enable(ERule const rule, b8 const enabled = true) -> void {
+            m_enabled[static_cast<szt>(rule)] = enabled;
+        }
+
+        [[nodiscard]] auto enabled(ERule const rule) const -> b8 {
+            return m_enabled[static_cast<szt>(rule)];
+        }
+
+        [[nodiscard]] auto find(
+            ERule const rule, TokenStream::Position const begin
+        ) -> Entry const* {
+            auto const entry = m_entries.find(key(rule, begin));
+            if (entry == m_entries.end()) {
+                return nullptr;
+            }
+            ++m_hits;
+            return &entry->second;
+        }
+
+        auto insert(
+            ERule const rule, TokenStream::Position const begin, Entry entry
+        ) -> void {
+            m_entries.insert_or_assign(key(rule, begin), std::move(entry));
+        }
+
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_entries.size();
+        }
+
+        // lookups that found an entry so far
+        [[nodiscard]] auto hits() const noexcept -> szt {
+            return m_hits;
+        }
+
+    private:
+        static constexpr szt ruleCount = static_cast<szt>(ERule::RecordExpr) + 1;
+
+        static auto key(ERule const rule, TokenStream::Position const begin)
+            -> u64 {
+            return static_cast<u64>(rule) << 33 |
+                static_cast<u64>(begin.index) << 1 | begin.started;
+        }
+
+    private:
+        Arr<b8, ruleCount> m_enabled{};
+        HashMap<u64, Entry> m_entries{};
+        szt m_hits{};
+    };
+}
+
+#endif // TLC_PARSE_MEMO_HPP
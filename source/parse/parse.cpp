@@ -1,8 +1,16 @@
 #include "parse.hpp"
 
 namespace tlc::parse {
-    auto Parse::operator()(fs::path filepath, Vec<token::Token> tokens) -> syntax::Node {
-        return Parse{std::move(filepath), std::move(tokens)}();
+    auto Parse::operator()(token::TokenizedBuffer tokens) -> syntax::Node {
+        return Parse{std::move(tokens)}();
+    }
+
+    auto Parse::operator()(lex::Lex lexer) -> syntax::Node {
+        return Parse{std::move(lexer)}();
+    }
+
+    auto Parse::flat(lex::Lex lexer) -> syntax::Arena {
+        return Parse{std::move(lexer)}.flat();
     }
 
     auto Parse::operator()() -> syntax::Node {
@@ -10,10 +18,31 @@ namespace tlc::parse {
             [this](auto&& err) -> ParseResult {
                 collect(err);
                 return syntax::TranslationUnit{
-                    m_filepath, syntax::RequiredButMissing{},
+                    m_file, syntax::RequiredButMissing{},
                     {}, {}
                 };
             }
         );
     }
+
+    auto Parse::flat() -> syntax::Arena {
+        syntax::Arena arena;
+        Vec<syntax::NodeId> children;
+
+        if (auto moduleDecl = handleModuleDecl(); moduleDecl) {
+            children.push_back(arena.insert(*moduleDecl));
+            children.push_back(arena.insert(handleImportDeclGroup()));
+            handleDefinitions([&](syntax::Node const& definition) {
+                children.push_back(arena.insert(definition));
+            });
+        }
+        else {
+            collect(missingModuleDecl().error());
+            children.push_back(arena.insert(syntax::RequiredButMissing{}));
+            children.push_back(arena.insert(syntax::Empty{}));
+        }
+
+        arena.insert(syntax::TranslationUnit{m_file, {}, {}, {}}, children);
+        return arena;
+    }
 }
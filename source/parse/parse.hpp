@@ -10,27 +10,58 @@
 #include "pretty_printer.hpp"
 #include "token_stream.hpp"
 #include "combinator.hpp"
+#include "first_set.hpp"
 #include "location_tracker.hpp"
+#include "memo.hpp"
 
 namespace tlc::parse {
     class Parse final {
-        using TokenIt = Vec<token::Token>::const_iterator;
         using TError = Error<EParseErrorContext, EParseErrorReason>;
         using TErrorCollector =
         ErrorCollector<EParseErrorContext, EParseErrorReason>;
         using ParseResult = Expected<syntax::Node, TError>;
 
     public:
-        static auto operator()(fs::path filepath, Vec<token::Token> tokens)
-            -> syntax::Node;
+        static auto operator()(token::TokenizedBuffer tokens) -> syntax::Node;
+        static auto operator()(lex::Lex lexer) -> syntax::Node;
 
-        Parse(fs::path filepath, Vec<token::Token> tokens)
-            : m_filepath{std::move(filepath)},
+        explicit Parse(token::TokenizedBuffer tokens)
+            : m_file{tokens.file()},
               m_stream{std::move(tokens)},
-              m_tracker{m_stream}, m_isSubroutine{false} {}
+              m_tracker{m_stream} {}
+
+        // parses the tokens while they are being lexed
+        explicit Parse(lex::Lex lexer)
+            : m_file{lexer.file()},
+              m_stream{std::move(lexer)},
+              m_tracker{m_stream} {}
 
         auto operator()() -> syntax::Node;
 
+        static auto flat(lex::Lex lexer) -> syntax::Arena;
+
+        /**
+         * Same tree as operator(), laid out in an Arena. Each definition is
+         * flattened as soon as it is parsed, so at most one definition exists
+         * as syntax::Node at a time.
+         */
+        auto flat() -> syntax::Arena;
+
+        // remembers the results of {rule} by position, for rules that are
+        // attempted again after backtracking
+        auto memoize(ERule const rule, b8 const enabled = true) -> void {
+            m_memo.enable(rule, enabled);
+        }
+
+        /**
+         * Parses expressions with the recursive precedence climber instead
+         * of the iterative one. Both build the same trees; the recursive one
+         * is kept as a reference for tests and benchmarks.
+         */
+        auto recursiveExpressions(b8 const enabled = true) noexcept -> void {
+            m_recursiveExprs = enabled;
+        }
+
 #ifdef TLC_CONFIG_BUILD_TESTS
         auto parseType() -> ParseResult {
             return handleType();
@@ -51,23 +82,55 @@ namespace tlc::parse {
         auto parseGenericParamsDecl() -> ParseResult {
             return handleGenericParamsDecl();
         }
+
+        [[nodiscard]] auto backtracks() const noexcept -> szt {
+            return m_stream.backtracks();
+        }
+
+        [[nodiscard]] auto memo() const noexcept -> Memo const& {
+            return m_memo;
+        }
 #endif
 
     private:
-        Parse(fs::path filepath, Vec<token::Token> tokens, Location offset)
-            : m_filepath{std::move(filepath)},
-              m_stream{std::move(tokens), std::move(offset)},
-              m_tracker{m_stream}, m_isSubroutine{true} {}
+        enum class EGroup : u8 {
+            Tuple, Array, Record,
+        };
+
+        // a tuple, array or record expression while its elements are parsed
+        struct ExprGroup;
 
-    private:
         auto handleExpr(syntax::OpPrecedence minP = 0) -> ParseResult;
+        auto handleRecursiveExpr(syntax::OpPrecedence minP) -> ParseResult;
         auto handlePrimaryExpr() -> ParseResult;
+        // whether the next tokens are a path ending in a type followed by '{'
+        auto startsRecord() -> b8;
         auto handleRecordExpr() -> ParseResult;
         auto handleTupleExpr() -> ParseResult;
         auto handleArrayExpr() -> ParseResult;
+        // parses the whole of {group}, each element with a call to handleExpr
+        auto handleGroupExpr(ExprGroup& group) -> ParseResult;
+        /**
+         * Consumes what opens {group}, up to the key of its first entry for
+         * a record. The group is returned if that already completes it,
+         * otherwise its first element follows.
+         */
+        auto openGroup(ExprGroup& group) -> Opt<ParseResult>;
+        // consumes the key of the next entry of a record
+        auto beginElement(ExprGroup& group) -> void;
+        /**
+         * Adds the {element} parsed last to {group}, collecting its error
+         * if it failed. Returns whether another element follows, with the
+         * separator consumed.
+         */
+        auto endElement(ExprGroup& group, ParseResult element) -> b8;
+        // consumes what closes {group}
+        auto closeGroup(ExprGroup& group) -> syntax::Node;
         auto handleSingleTokenLiteral() -> ParseResult;
         auto handleIdentifierLiteral() -> ParseResult;
         auto handleString() -> ParseResult;
+        // skips the rest of a placeholder up to and including its end marker
+        auto skipPlaceholder() -> void;
         auto handleTryExpr() -> ParseResult;
 
         auto handleType(syntax::OpPrecedence minP = 0) -> ParseResult;
@@ -82,6 +145,8 @@ namespace tlc::parse {
         auto handleGenericParamsDecl() -> ParseResult;
 
         auto handleStmt() -> ParseResult;
+        // whether a declaration statement may start at the next token
+        auto startsDeclStmt() -> b8;
         auto handleDeclStmt() -> ParseResult;
         auto handleReturnStmt() -> ParseResult;
         auto handleDeferStmt() -> ParseResult;
@@ -90,14 +155,19 @@ namespace tlc::parse {
         auto handleMatchStmt() -> ParseResult;
         auto handleBlockStmt() -> ParseResult;
 
-        auto handleFunctionDef(token::Token const& visibility) -> ParseResult;
+        auto handleFunctionDef(token::TokenView visibility) -> ParseResult;
         auto handleFunctionPrototype() -> ParseResult;
-        auto handleTypeDef(token::Token const& visibility) -> ParseResult;
-        auto handleEnumDef(token::Token const& visibility) -> ParseResult;
-        auto handleTraitDef(token::Token const& visibility) -> ParseResult;
-        auto handleFlagDef(token::Token const& visibility) -> ParseResult;
+        auto handleTypeDef(token::TokenView visibility) -> ParseResult;
+        auto handleEnumDef(token::TokenView visibility) -> ParseResult;
+        auto handleTraitDef(token::TokenView visibility) -> ParseResult;
+        auto handleFlagDef(token::TokenView visibility) -> ParseResult;
         auto handleModuleDecl() -> ParseResult;
         auto handleImportDecl() -> ParseResult;
+        // the group of the imports that follow, or an empty node
+        auto handleImportDeclGroup() -> syntax::Node;
+        // parses the definitions up to the end of the unit, passing each one
+        // to {emit}
+        auto handleDefinitions(Fn<void(syntax::Node)> const& emit) -> void;
         auto handleTranslationUnit() -> ParseResult;
 
     private:
@@ -105,39 +175,97 @@ namespace tlc::parse {
             return Unexpected{TError{}};
         }
 
+        [[nodiscard]] auto missingModuleDecl() const -> Unexpected<TError> {
+            return error({
+                .context = EParseErrorContext::TranslationUnit,
+                .reason = EParseErrorReason::MissingDecl,
+            });
+        }
+
         [[nodiscard]] auto error(TError::Params params) const
             -> Unexpected<TError> {
-            params.filepath = m_filepath;
             params.location = m_tracker.current();
             return Unexpected<TError>{std::move(params)};
         }
 
         auto collect(TError::Params errorParams) const -> TErrorCollector& {
-            errorParams.filepath = m_filepath;
+            if (errorParams.location.file == SourceManager::noFile) {
+                errorParams.location.file = m_file;
+            }
             return collect(TError{std::move(errorParams)});
         }
 
         auto collect(TError error) const -> TErrorCollector& {
-            static auto& collector = TErrorCollector::instance();
+            auto& collector = TErrorCollector::instance();
 
             if (error.reason() == EParseErrorReason::NotAnError) {
                 return collector;
             }
 
-            error.filepath(m_filepath);
             return collector.collect(std::move(error));
         }
 
-        [[nodiscard]] auto createDefaultVisibility() const -> token::Token {
+        // parses {rule} through the memo when it is enabled for the rule
+        template <typename F>
+        auto memoized(ERule const rule, F&& parse) -> ParseResult {
+            if (!m_memo.enabled(rule)) {
+                return std::forward<F>(parse)();
+            }
+            if (auto recalled = recall(rule)) {
+                return *std::move(recalled);
+            }
+
+            auto const begin = m_stream.position();
+            auto const collected = TErrorCollector::instance().threadSize();
+            auto result = std::forward<F>(parse)();
+            remember(rule, begin, collected, result);
+            return result;
+        }
+
+        /**
+         * What parsing {rule} at the next token produced before, if it was
+         * memoized there. Its errors are collected again and the stream is
+         * moved past it.
+         */
+        auto recall(ERule const rule) -> Opt<ParseResult> {
+            auto const* entry = m_memo.find(rule, m_stream.position());
+            if (!entry) {
+                return std::nullopt;
+            }
+
+            for (auto const& error : entry->errors) {
+                collect(error);
+            }
+            m_stream.seek(entry->end);
+            return entry->result;
+        }
+
+        // memoizes {result} of {rule} started at {begin}, along with the
+        // errors collected since there were {collected} of them
+        auto remember(
+            ERule const rule, TokenStream::Position const begin,
+            szt const collected, ParseResult const& result
+        ) -> void {
+            m_memo.insert(rule, begin, {
+                result, m_stream.position(),
+                TErrorCollector::instance().threadSince(collected)
+                    | rng::to<Vec<TError>>(),
+            });
+        }
+
+        [[nodiscard]] auto createDefaultVisibility() const -> token::TokenView {
             return {lexeme::empty, "", m_stream.peek().location()};
         }
 
     private:
-        fs::path m_filepath;
+        FileID m_file;
         TokenStream m_stream;
         LocationTracker m_tracker;
-        Stack<Location> m_coords{};
-        b8 const m_isSubroutine;
+        Memo m_memo{};
+        b8 m_recursiveExprs{};
+        Stack<SourceLocation> m_coords{};
+        // string interpolation does not nest
+        b8 m_inPlaceholder = false;
     };
 }
 
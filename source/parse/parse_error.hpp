@@ -12,13 +12,13 @@ namespace tlc::parse {
         AssignStmt, ExprStmt, CondStmt, YieldStmt, LoopStmt, MatchStmt,
         MatchCaseStmt, MatchCaseDefaultStmt, GenericTypeArguments, BinaryTypeExpr,
         TryExpr, GenericParamsDecl, TranslationUnit, ModuleDecl, ImportDecl,
-        FunctionPrototype, Function
+        FunctionPrototype, Function, NumericLiteral,
     };
 
     enum class EParseErrorReason {
         NotAnError, MissingSymbol, MissingKeyword, MissingEnclosingSymbol,
         MissingExpr, MissingType, MissingId, MissingDecl, MissingStmt,
-        MissingBody, RestrictedAction, Unknown,
+        MissingBody, RestrictedAction, OutOfRange, Unknown,
     };
 }
 
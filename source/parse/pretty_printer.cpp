@@ -15,7 +15,7 @@ namespace tlc::parse {
     }
 
     auto PrettyPrint::operator()(syntax::expr::Identifier const& node) -> Str {
-        return node.path();
+        return Str{node.path()};
     }
 
     auto PrettyPrint::operator()(syntax::expr::Tuple const& node) -> Str {
@@ -95,11 +95,11 @@ namespace tlc::parse {
     }
 
     auto PrettyPrint::operator()(syntax::type::Identifier const& node) -> Str {
-        return node.constant() ? node.path() : "$" + node.path();
+        return node.constant() ? Str{node.path()} : "$"s + node.path();
     }
 
     auto PrettyPrint::operator()(syntax::type::Infer const& node) -> Str {
-        return std::format("[[ {} ]]", visitChildren(node).front());
+        return std::format("[[ {} ]]", std::visit(*this, node.expr()));
     }
 
     auto PrettyPrint::operator()(syntax::type::Array const& node) -> Str {
@@ -129,7 +129,7 @@ namespace tlc::parse {
         auto children = visitChildren(node);
         return std::format(
             "({} {} {})", std::move(children.front()), node.op().str(),
-            visitChildren(node).back()
+            std::move(children.back())
         );
     }
 
@@ -236,7 +236,7 @@ namespace tlc::parse {
 
     auto PrettyPrint::operator()(syntax::global::ImportDecl const& node) -> Str {
         auto children = visitChildren(node);
-        if (children.back() == empty) {
+        if (syntax::isEmptyNode(node.lastChild())) {
             return std::format("import {};", children.front());
         }
         return std::format(
@@ -259,15 +259,16 @@ namespace tlc::parse {
     }
 
     auto PrettyPrint::operator()(syntax::TranslationUnit const& node) -> Str {
+        if (syntax::astGetIf<syntax::RequiredButMissing>(node.firstChild())) {
+            return "";
+        }
+
         auto children = visitChildren(node);
         auto moduleDecl = children.front();
         auto importDeclGroup = children[1];
-
-        if (moduleDecl == required) {
-            return "";
-        }
+        auto const noImports = syntax::isEmptyNode(node.childAt(1));
         if (children.size() < 3) {
-            if (importDeclGroup == empty) {
+            if (noImports) {
                 return std::format("{}", std::move(moduleDecl));
             }
             return std::format(
@@ -277,7 +278,7 @@ namespace tlc::parse {
 
         auto definitions = children | rv::as_rvalue | rv::drop(2)
             | rv::join_with("\n\n"sv) | rng::to<Str>();
-        if (importDeclGroup == empty) {
+        if (noImports) {
             return std::format(
                 "{}\n\n{}", std::move(moduleDecl), std::move(definitions)
             );
@@ -17,6 +17,11 @@ namespace tlc::parse {
             return std::visit(PrettyPrint{}, node);
         }
 
+        static auto operator()(syntax::Arena const& arena, syntax::NodeId const id)
+            -> Str {
+            return std::visit(PrettyPrint{}, arena.node(id));
+        }
+
     public:
         auto operator()(syntax::expr::Integer const& node) -> Str;
         auto operator()(syntax::expr::Float const& node) -> Str;
@@ -1,8 +1,16 @@
 #include "token_stream.hpp"
 
 namespace tlc::parse {
+    TokenStream::TokenStream(lex::Lex lexer)
+        : m_lexer{std::move(lexer)},
+          m_source{SourceManager::instance().buffer(m_lexer->file())->view()},
+          m_window(initialWindowSize, invalidToken),
+          m_spellings(initialWindowSize) {
+        fill(peekIndex());
+    }
+
     auto TokenStream::match(MatchFn const cond) -> bool {
-        if (done() || !cond(peek().lexeme())) {
+        if (done() || !cond(peekLexeme())) {
             return false;
         }
         advance();
@@ -12,38 +20,124 @@ namespace tlc::parse {
     auto TokenStream::advance() -> void {
         if (!m_started) {
             m_started = true;
-            return;
         }
-        ++m_tokenIt;
+        else {
+            ++m_index;
+        }
+        fill(peekIndex());
     }
 
-    auto TokenStream::peek() const -> token::Token {
-        if (!m_started) {
-            return *m_tokenIt;
+    auto TokenStream::peek() const -> token::TokenView {
+        if (auto const next = peekIndex(); next < size()) {
+            return tokenAt(next);
         }
-        if (auto const nextIt = std::next(m_tokenIt);
-            nextIt != m_tokens.end()) {
-            return *nextIt;
+        return invalidToken;
+    }
+
+    auto TokenStream::lookahead(szt const distance) -> lexeme::Lexeme {
+        auto const index = peekIndex() + static_cast<token::TokenIndex>(distance);
+        fill(index);
+        if (index >= size()) {
+            return lexeme::invalid;
         }
-        return makeInvalidToken();
+        return m_lexer
+            ? m_window[slot(index)].lexeme()
+            : m_tokens.lexeme(index);
+    }
+
+    auto TokenStream::seek(Position const position) -> void {
+        m_index = position.index;
+        m_started = position.started;
+        fill(peekIndex());
     }
 
     auto TokenStream::backtrack() -> void {
         if (m_backtrack.empty()) {
             return;
         }
-        auto [it, started] = m_backtrack.top();
-        m_tokenIt = it;
+        auto [index, started] = m_backtrack.back();
+        m_index = index;
         m_started = started;
-        m_backtrack.pop();
+        m_backtrack.pop_back();
+        ++m_backtracks;
     }
 
-    auto TokenStream::current() const -> token::Token {
+    auto TokenStream::current() const -> token::TokenView {
         if (done() || !m_started) {
-            return makeInvalidToken();
+            return invalidToken;
+        }
+        return tokenAt(m_index);
+    }
+
+    auto TokenStream::peekLexeme() const -> lexeme::Lexeme {
+        if (auto const next = peekIndex(); next < size()) {
+            return m_lexer
+                ? m_window[slot(next)].lexeme()
+                : m_tokens.lexeme(next);
         }
-        return *m_tokenIt;
+        return lexeme::invalid;
     }
 
+    auto TokenStream::tokenAt(token::TokenIndex const index) const
+        -> token::TokenView {
+        return m_lexer
+            ? m_window[slot(index)]
+            : m_tokens.view(index);
+    }
 
+    auto TokenStream::spelledBySource(StrV const spelling) const noexcept -> b8 {
+        auto const* const begin = m_source.data();
+        auto const* const end = begin + m_source.size();
+        return spelling.empty() || (
+            std::less_equal<>{}(begin, spelling.data()) &&
+            std::less_equal<>{}(spelling.data() + spelling.size(), end)
+        );
+    }
+
+    auto TokenStream::fill(token::TokenIndex const index) -> void {
+        if (!m_lexer) {
+            return;
+        }
+
+        while (m_lexed <= index) {
+            auto token = m_lexer->next();
+            if (!token) {
+                return;
+            }
+
+            if (m_lexed >= m_window.size() &&
+                m_lexed - m_window.size() >= pinned()) {
+                // the slot would be reused while still pinned
+                growWindow();
+            }
+
+            auto const s = slot(static_cast<token::TokenIndex>(m_lexed));
+            if (spelledBySource(token->str())) {
+                m_spellings[s].reset();
+            }
+            else {
+                // the lexer reuses its storage for the next construct
+                m_spellings[s] = std::make_unique<Str const>(token->str());
+                token = token::TokenView{
+                    token->lexeme(), *m_spellings[s], token->location(),
+                    token->symbol(), token->value()
+                };
+            }
+            m_window[s] = *token;
+            ++m_lexed;
+        }
+    }
+
+    // owned spellings are moved by pointer, so views of them stay valid
+    auto TokenStream::growWindow() -> void {
+        Vec<token::TokenView> window(m_window.size() * 2, invalidToken);
+        Vec<Ptr<Str const>> spellings(window.size());
+        for (auto index = pinned(); index < m_lexed; ++index) {
+            auto const s = index & (window.size() - 1);
+            window[s] = m_window[slot(index)];
+            spellings[s] = std::move(m_spellings[slot(index)]);
+        }
+        m_window = std::move(window);
+        m_spellings = std::move(spellings);
+    }
 }
@@ -3,12 +3,12 @@
 
 #include "token/token.hpp"
 #include "core/core.hpp"
+#include "lex/lex.hpp"
 
 namespace tlc::parse {
     class TokenStream final {
     public:
-        using MatchFn = bool (*)(lexeme::Lexeme const&);
-        using TokenIt = token::TokenizedBuffer::const_iterator;
+        using MatchFn = bool (*)(lexeme::Lexeme);
 
         class Backtrack final {
         public:
@@ -37,23 +37,29 @@ namespace tlc::parse {
         };
 
     public:
-        explicit TokenStream(token::TokenizedBuffer tokens, Opt<Location> offset = {})
-            : m_tokens{
-                  offset
-                      ? tokens | rv::transform([offset](token::Token const& token) {
-                          return token::Token{
-                              token.lexeme(), token.str(), Location{
-                                  .line = token.line() + offset->line,
-                                  .column = token.column() + offset->column,
-                              }
-                          };
-                      }) | rng::to<token::TokenizedBuffer>()
-                      : std::move(tokens)
-              },
-              m_tokenIt{m_tokens.begin()} {}
+        struct Position {
+            token::TokenIndex index;
+            b8 started;
+        };
+
+        // what peek() and current() return past either end of the stream
+        static constexpr token::TokenView invalidToken{lexeme::invalid, "", {}};
+
+        explicit TokenStream(token::TokenizedBuffer tokens)
+            : m_tokens{std::move(tokens)} {}
+
+        /**
+         * Streams the tokens from {lexer} as they are needed instead of
+         * lexing the whole source up front. Views of the tokens are kept in a
+         * ring buffer that only grows when a Backtrack mark still pins the
+         * oldest of them, so memory is bounded by the deepest backtrack
+         * rather than by the size of the source. Views keep referring to the
+         * source, or to a spelling the stream owns, when the ring grows.
+         */
+        explicit TokenStream(lex::Lex lexer);
 
         auto match(std::same_as<lexeme::Lexeme> auto... types) -> bool {
-            auto const tokenType = peek().lexeme();
+            auto const tokenType = peekLexeme();
             if (done() || ((tokenType != types) && ...)) {
                 return false;
             }
@@ -65,10 +71,41 @@ namespace tlc::parse {
 
         auto advance() -> void;
 
-        [[nodiscard]] auto peek() const -> token::Token;
+        /**
+         * The next token, without copying it. When streaming, the view stays
+         * valid as long as the window holds the token, i.e. until the stream
+         * moves past it and past the oldest Backtrack mark still alive.
+         */
+        [[nodiscard]] auto peek() const -> token::TokenView;
+
+        // the lexeme {distance} tokens after the next one, lexing up to it
+        // if needed
+        [[nodiscard]] auto lookahead(szt distance) -> lexeme::Lexeme;
+
+        // index of the token peek() returns
+        [[nodiscard]] auto nextIndex() const noexcept -> token::TokenIndex {
+            return peekIndex();
+        }
+
+        /**
+         * The token at {index}, which must be the current one or one before
+         * it that the window still holds, i.e. one matched since the oldest
+         * Backtrack mark that is still alive.
+         */
+        [[nodiscard]] auto at(token::TokenIndex const index) const
+            -> token::TokenView {
+            return tokenAt(index);
+        }
+
+        [[nodiscard]] auto position() const noexcept -> Position {
+            return {m_index, m_started};
+        }
+
+        // moves to a position the stream has been at before
+        auto seek(Position position) -> void;
 
         auto markBacktrack() -> void {
-            m_backtrack.push({m_tokenIt, m_started});
+            m_backtrack.push_back(position());
         }
 
         // todo: implement scoped backtrack
@@ -76,7 +113,7 @@ namespace tlc::parse {
             if (m_backtrack.empty()) {
                 return;
             }
-            m_backtrack.pop();
+            m_backtrack.pop_back();
         }
 
         auto backtrack() -> void;
@@ -85,28 +122,74 @@ namespace tlc::parse {
             return Backtrack{*this};
         }
 
-        [[nodiscard]] auto current() const -> token::Token;
+        [[nodiscard]] auto current() const -> token::TokenView;
 
         [[nodiscard]] auto done() const -> b8 {
             // todo:
-            return m_started && m_tokenIt == m_tokens.end();
+            return m_started && m_index >= size();
         }
 
-    private:
-        static auto makeInvalidToken() -> token::Token {
-            return {lexeme::invalid, "", {0, 0}};
+        // times the stream was rewound to a Backtrack mark so far
+        [[nodiscard]] auto backtracks() const noexcept -> szt {
+            return m_backtracks;
+        }
+
+        // number of tokens the ring buffer can hold when streaming
+        [[nodiscard]] auto windowSize() const noexcept -> szt {
+            return m_window.size();
         }
 
     private:
-        struct BacktrackStates {
-            TokenIt tokenIt;
-            b8 started;
-        };
+        static constexpr szt initialWindowSize = 64;
+
+        [[nodiscard]] auto peekIndex() const noexcept -> token::TokenIndex {
+            return m_started ? m_index + 1 : m_index;
+        }
+
+        [[nodiscard]] auto peekLexeme() const -> lexeme::Lexeme;
+
+        [[nodiscard]] auto tokenAt(token::TokenIndex index) const
+            -> token::TokenView;
+
+        // number of tokens available so far
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_lexer ? m_lexed : m_tokens.size();
+        }
 
+        // the oldest token that is still reachable, either as the current one
+        // or by backtracking
+        [[nodiscard]] auto pinned() const noexcept -> token::TokenIndex {
+            return m_backtrack.empty() ? m_index : m_backtrack.front().index;
+        }
+
+        [[nodiscard]] auto slot(token::TokenIndex const index) const noexcept
+            -> szt {
+            return index & (m_window.size() - 1);
+        }
+
+        // whether {spelling} is a view of the source rather than of the lexer
+        [[nodiscard]] auto spelledBySource(StrV spelling) const noexcept -> b8;
+
+        // streams tokens until the one at {index} is lexed or the source ends
+        auto fill(token::TokenIndex index) -> void;
+
+        auto growWindow() -> void;
+
+    private:
         token::TokenizedBuffer const m_tokens;
-        TokenIt m_tokenIt;
-        Stack<BacktrackStates> m_backtrack{};
+        token::TokenIndex m_index{};
+        // marks only ever restore the stream backwards, so they are sorted
+        Vec<Position> m_backtrack{};
         b8 m_started = false;
+        szt m_backtracks{};
+
+        Opt<lex::Lex> m_lexer{};
+        StrV m_source{};
+        // ring buffer indexed by TokenIndex modulo its power of two size
+        Vec<token::TokenView> m_window{};
+        // parallel to m_window, the spellings that are not views of the source
+        Vec<Ptr<Str const>> m_spellings{};
+        szt m_lexed{};
     };
 }
 
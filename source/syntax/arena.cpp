@@ -0,0 +1,130 @@
+#include "arena.hpp"
+#include "nodes.hpp"
+
+namespace tlc::syntax {
+    namespace {
+        auto childrenOf(Node const& node) noexcept -> Span<Node const> {
+            return std::visit([]<typename T>(T const& alternative) {
+                if constexpr (std::derived_from<T, detail::NodeBase>) {
+                    return alternative.children();
+                }
+                else {
+                    return Span<Node const>{};
+                }
+            }, node);
+        }
+    }
+
+    auto Arena::insert(Node const& root) -> NodeId {
+        struct Frame {
+            Node const* node;
+            // next child to insert
+            szt next;
+            // where the ids of the children start in m_pending
+            szt pending;
+        };
+
+        // a work list rather than recursion, so that deep trees fit
+        Vec<Frame> stack{{&root, 0, m_pending.size()}};
+        while (true) {
+            auto& frame = stack.back();
+            auto const children = childrenOf(*frame.node);
+            if (frame.next < children.size()) {
+                auto const* const child = &children[frame.next++];
+                stack.push_back({child, 0, m_pending.size()});
+                continue;
+            }
+
+            auto const id = insert(
+                *frame.node, Span<NodeId const>{m_pending}.subspan(frame.pending)
+            );
+            m_pending.resize(frame.pending);
+            stack.pop_back();
+            if (stack.empty()) {
+                return id;
+            }
+            m_pending.push_back(id);
+        }
+    }
+
+    auto Arena::insert(Node const& node, Span<NodeId const> const children)
+        -> NodeId {
+        m_kinds.push_back(static_cast<u8>(node.index()));
+
+        if (auto const payload = m_table.store(node); payload == Payload{}) {
+            m_payloadIndices.push_back(0);
+        }
+        else {
+            m_payloadIndices.push_back(static_cast<u32>(m_payloads.size()));
+            m_payloads.push_back(payload);
+        }
+
+        m_locations.push_back(std::visit([]<typename T>(T const& alternative) {
+            if constexpr (std::derived_from<T, detail::NodeBase>) {
+                return alternative.location();
+            }
+            else {
+                return SourceLocation{};
+            }
+        }, node));
+
+        m_children.append_range(children);
+        m_childBegin.push_back(static_cast<u32>(m_children.size()));
+        return root();
+    }
+
+    auto Arena::node(NodeId const id) const -> Node {
+        struct Frame {
+            NodeId id;
+            // next child to materialize
+            szt next;
+        };
+
+        // materialized subtrees whose parent has yet to be made
+        Vec<Node> made;
+        Vec<Frame> stack{{id, 0}};
+        while (!stack.empty()) {
+            auto& frame = stack.back();
+            auto const children = this->children(frame.id);
+            if (frame.next < children.size()) {
+                auto const child = children[frame.next++];
+                stack.push_back({child, 0});
+                continue;
+            }
+
+            auto const first = made.end() - static_cast<i64>(children.size());
+            Vec<Node> nodes{
+                std::make_move_iterator(first), std::make_move_iterator(made.end())
+            };
+            made.erase(first, made.end());
+
+            made.push_back(m_table.make(
+                kind(frame.id), payload(frame.id), location(frame.id),
+                std::move(nodes)
+            ));
+            stack.pop_back();
+        }
+        return std::move(made.back());
+    }
+
+    auto Arena::bytes() const noexcept -> szt {
+        return m_kinds.capacity() * sizeof(u8) +
+            m_payloadIndices.capacity() * sizeof(u32) +
+            m_locations.capacity() * sizeof(SourceLocation) +
+            m_childBegin.capacity() * sizeof(u32) +
+            (m_children.capacity() + m_pending.capacity()) * sizeof(NodeId) +
+            m_payloads.capacity() * sizeof(Payload) +
+            m_table.bytes();
+    }
+
+    auto Arena::clear() noexcept -> void {
+        m_kinds.clear();
+        m_payloadIndices.clear();
+        m_locations.clear();
+        m_childBegin.assign(1, 0);
+        m_children.clear();
+        m_pending.clear();
+        m_payloads.assign(1, Payload{});
+        m_table.clear();
+    }
+}
@@ -0,0 +1,178 @@
+#ifndef TLC_SYNTAX_ARENA_HPP
+#define TLC_SYNTAX_ARENA_HPP
+
+#include "core/core.hpp"
+#include "forward.hpp"
+#include "token/token.hpp"
+#include "payload.hpp"
+
+namespace tlc::syntax {
+    template <typename T>
+    class ArenaNode;
+
+    /**
+     * Owns every node of one translation unit, laid out as parallel arrays in
+     * post-order: one kind byte, one payload index and one location per node,
+     * and the children of each node as a contiguous range of a shared child
+     * list. Children always precede their parent and the root comes last, so
+     * passes that only look at some kinds of nodes can scan kinds() front to
+     * back. Paths, string fragments and literals live in a PayloadTable, and
+     * nodes without a payload share the one at index 0.
+     *
+     * visit() dispatches on the stored kind and reads the node in place
+     * through an ArenaNode. Visitors written against syntax::Node, the
+     * printers among them, go through node(), which materializes a subtree.
+     */
+    class Arena final {
+    public:
+        Arena() = default;
+
+        explicit Arena(Node const& root) {
+            insert(root);
+        }
+
+        // copies the tree rooted at {root} into the arena, children first
+        auto insert(Node const& root) -> NodeId;
+
+        // inserts {node} as the parent of the already inserted {children},
+        // ignoring any children {node} holds itself
+        auto insert(Node const& node, Span<NodeId const> children) -> NodeId;
+
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_kinds.size();
+        }
+
+        // the node inserted last, i.e. the root of the last inserted tree
+        [[nodiscard]] auto root() const noexcept -> NodeId {
+            return static_cast<NodeId>(size() - 1);
+        }
+
+        // index of the alternative of syntax::Node of every node, in order
+        [[nodiscard]] auto kinds() const noexcept -> Span<u8 const> {
+            return m_kinds;
+        }
+
+        [[nodiscard]] auto kind(NodeId const id) const noexcept -> szt {
+            return m_kinds[id];
+        }
+
+        template <typename T>
+        [[nodiscard]] auto holds(NodeId const id) const noexcept -> b8 {
+            return kind(id) == nodeIndex<T>;
+        }
+
+        [[nodiscard]] auto payload(NodeId const id) const noexcept
+            -> Payload const& {
+            return m_payloads[m_payloadIndices[id]];
+        }
+
+        // the side tables payloads refer to
+        [[nodiscard]] auto payloads() const noexcept -> PayloadTable const& {
+            return m_table;
+        }
+
+        [[nodiscard]] auto location(NodeId const id) const noexcept
+            -> SourceLocation {
+            return m_locations[id];
+        }
+
+        [[nodiscard]] auto children(NodeId const id) const noexcept
+            -> Span<NodeId const> {
+            return Span<NodeId const>{m_children}.subspan(
+                m_childBegin[id], m_childBegin[id + 1] - m_childBegin[id]
+            );
+        }
+
+        // the subtree rooted at {id} as a syntax::Node
+        [[nodiscard]] auto node(NodeId id) const -> Node;
+
+        /**
+         * Calls {visitor} with the ArenaNode of {id} for the alternative of
+         * syntax::Node the node holds. Every call must return the same type.
+         */
+        template <typename TVisitor>
+        auto visit(NodeId id, TVisitor&& visitor) const -> decltype(auto);
+
+        // visits every node in post-order, children before their parent
+        template <typename TVisitor>
+        auto visit(TVisitor&& visitor) const -> void {
+            for (NodeId id = 0; id < size(); ++id) {
+                visit(id, visitor);
+            }
+        }
+
+        // memory held by the arena, including unused capacity
+        [[nodiscard]] auto bytes() const noexcept -> szt;
+
+        auto clear() noexcept -> void;
+
+    private:
+        static_assert(std::variant_size_v<Node> <= 256);
+
+    private:
+        Vec<u8> m_kinds{};
+        Vec<u32> m_payloadIndices{};
+        Vec<SourceLocation> m_locations{};
+        // the children of node i are m_children[m_childBegin[i], m_childBegin[i + 1])
+        Vec<u32> m_childBegin{0};
+        Vec<NodeId> m_children{};
+        // ids of the children inserted so far for the nodes being inserted
+        Vec<NodeId> m_pending{};
+        Vec<Payload> m_payloads{Payload{}};
+        PayloadTable m_table{};
+    };
+
+    // node {id} of an arena, which holds alternative {T} of syntax::Node
+    template <typename T>
+    class ArenaNode final {
+    public:
+        ArenaNode(Arena const& arena, NodeId const id) noexcept
+            : m_arena{&arena}, m_id{id} {}
+
+        [[nodiscard]] auto id() const noexcept -> NodeId {
+            return m_id;
+        }
+
+        [[nodiscard]] auto arena() const noexcept -> Arena const& {
+            return *m_arena;
+        }
+
+        [[nodiscard]] auto children() const noexcept -> Span<NodeId const> {
+            return m_arena->children(m_id);
+        }
+
+        [[nodiscard]] auto location() const noexcept -> SourceLocation {
+            return m_arena->location(m_id);
+        }
+
+        [[nodiscard]] auto payload() const noexcept -> Payload const& {
+            return m_arena->payload(m_id);
+        }
+
+    private:
+        Arena const* m_arena;
+        NodeId m_id;
+    };
+
+    template <typename TVisitor>
+    auto Arena::visit(NodeId const id, TVisitor&& visitor) const
+        -> decltype(auto) {
+        using Result = std::invoke_result_t<
+            TVisitor&, ArenaNode<std::variant_alternative_t<0, Node>>
+        >;
+        using Visit = Result (*)(Arena const&, NodeId, TVisitor&);
+        static constexpr auto visits = []<szt... I>(std::index_sequence<I...>) {
+            return Arr<Visit, sizeof...(I)>{
+                [](Arena const& arena, NodeId const node, TVisitor& f) -> Result {
+                    return f(ArenaNode<std::variant_alternative_t<I, Node>>{
+                        arena, node
+                    });
+                }...
+            };
+        }(std::make_index_sequence<std::variant_size_v<Node>>{});
+
+        return visits[kind(id)](*this, id, visitor);
+    }
+}
+
+#endif // TLC_SYNTAX_ARENA_HPP
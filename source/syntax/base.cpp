@@ -2,8 +2,70 @@
 #include "nodes.hpp"
 
 namespace tlc::syntax::detail {
-    NodeBase::NodeBase(Vec<Node> children, Location coords) noexcept
-        : m_children(std::move(children)), m_location(std::move(coords)) {}
+    NodeBase::NodeBase(Vec<Node> children, SourceLocation const coords) noexcept
+        : m_children(std::move(children)), m_location(coords) {}
+
+    namespace {
+        struct PendingCopy {
+            NodeBase const* source;
+            NodeBase* target;
+        };
+
+        // the nodes whose children the outermost copy on this thread has
+        // yet to copy, null while no copy is in progress
+        thread_local Vec<PendingCopy>* pendingCopies = nullptr;
+    }
+
+    NodeBase::NodeBase(NodeBase const& other) : m_location{other.m_location} {
+        // copying a child copies its own node but leaves its children to the
+        // copy of the outermost ancestor, so a deep tree cannot overflow the
+        // stack
+        if (pendingCopies) {
+            pendingCopies->push_back({&other, this});
+            return;
+        }
+
+        Vec<PendingCopy> pending{{&other, this}};
+        pendingCopies = &pending;
+        try {
+            while (!pending.empty()) {
+                auto const [source, target] = pending.back();
+                pending.pop_back();
+                target->m_children = source->m_children;
+            }
+        }
+        catch (...) {
+            pendingCopies = nullptr;
+            throw;
+        }
+        pendingCopies = nullptr;
+    }
+
+    auto NodeBase::operator=(NodeBase const& other) -> NodeBase& {
+        // assigning the children one by one would recurse once per level
+        if (this != &other) {
+            *this = NodeBase{other};
+        }
+        return *this;
+    }
+
+    NodeBase::~NodeBase() noexcept {
+        // descendants are moved into one list and destroyed childless, so a
+        // deep tree, e.g. a long chain of binary operators, cannot overflow
+        // the stack
+        auto pending = std::move(m_children);
+        while (!pending.empty()) {
+            auto node = std::move(pending.back());
+            pending.pop_back();
+            std::visit([&]<typename T>(T& alternative) {
+                if constexpr (std::derived_from<T, NodeBase>) {
+                    auto& children = static_cast<NodeBase&>(alternative).m_children;
+                    pending.append_range(children | rv::as_rvalue);
+                    children.clear();
+                }
+            }, node);
+        }
+    }
 
     auto NodeBase::children() const noexcept -> Span<Node const> {
         return m_children;
@@ -41,21 +103,23 @@ namespace tlc::syntax::detail {
         return m_children.size();
     }
 
-    auto IdentifierBase::path() const noexcept -> Str {
+    IdentifierBase::IdentifierBase(Path path)
+        : m_path{std::move(path)} {
         if (m_path.empty()) {
-            return "";
+            return;
         }
 
-        Str pathStr = m_path.front();
-
         if (!imported()) {
-            return pathStr;
+            m_symbol = m_path.front();
+            return;
         }
 
-        for (StrV s : m_path | rv::drop(1)) {
-            pathStr += "."s + Str(s);
+        Str pathStr{m_path.front().str()};
+        for (auto const segment : m_path | rv::drop(1)) {
+            pathStr += '.';
+            pathStr += segment.str();
         }
 
-        return pathStr;
+        m_symbol = Interner::instance().intern(pathStr);
     }
 }
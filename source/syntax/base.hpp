@@ -8,6 +8,15 @@
 namespace tlc::syntax::detail {
     class NodeBase {
     public:
+        // copies the descendants without recursing once per level
+        NodeBase(NodeBase const& other);
+        NodeBase(NodeBase&&) noexcept = default;
+        auto operator=(NodeBase const& other) -> NodeBase&;
+        auto operator=(NodeBase&&) noexcept -> NodeBase& = default;
+
+        // destroys the descendants without recursing once per level
+        ~NodeBase() noexcept;
+
         [[nodiscard]] auto children() const noexcept -> Span<Node const>;
 
         [[nodiscard]] auto children() noexcept -> Span<Node>;
@@ -20,16 +29,20 @@ namespace tlc::syntax::detail {
 
         [[nodiscard]] auto nChildren() const noexcept -> szt;
 
-        [[nodiscard]] auto line() const noexcept -> szt {
-            return m_location.line;
+        [[nodiscard]] auto location() const noexcept -> SourceLocation {
+            return m_location;
         }
 
-        [[nodiscard]] auto column() const noexcept -> szt {
-            return m_location.column;
+        [[nodiscard]] auto line() const -> szt {
+            return SourceManager::instance().location(m_location).line;
+        }
+
+        [[nodiscard]] auto column() const -> szt {
+            return SourceManager::instance().location(m_location).column;
         }
 
     protected:
-        NodeBase(Vec<Node> children, Location coords) noexcept;
+        NodeBase(Vec<Node> children, SourceLocation coords) noexcept;
 
         auto childAt(szt index) -> Node&;
 
@@ -39,19 +52,29 @@ namespace tlc::syntax::detail {
 
     private:
         Vec<Node> m_children;
-        Location m_location;
+        SourceLocation m_location;
     };
 
     class IdentifierBase {
     public:
-        explicit IdentifierBase(Vec<Str> path)
-            : m_path{std::move(path)} {}
+        explicit IdentifierBase(Path path);
 
-        [[nodiscard]] auto name() const noexcept -> Str {
-            return m_path.empty() ? "" : m_path.back();
+        [[nodiscard]] auto name() const noexcept -> StrV {
+            return m_path.empty() ? "" : m_path.back().str();
         }
 
-        [[nodiscard]] auto path() const noexcept -> Str;
+        // dot-separated path, interned once on construction
+        [[nodiscard]] auto path() const noexcept -> StrV {
+            return m_symbol.str();
+        }
+
+        [[nodiscard]] auto symbol() const noexcept -> Symbol {
+            return m_symbol;
+        }
+
+        [[nodiscard]] auto segments() const noexcept -> Span<Symbol const> {
+            return m_path;
+        }
 
         [[nodiscard]] auto imported() const noexcept -> bool {
             return m_path.size() > 1;
@@ -62,7 +85,8 @@ namespace tlc::syntax::detail {
         }
 
     protected:
-        Vec<Str> m_path;
+        Path m_path;
+        Symbol m_symbol;
     };
 }
 
@@ -60,6 +60,9 @@ namespace tlc::syntax {
         struct Function;
     }
 
+    // segments of a dotted path, inline up to the common case of two
+    using Path = SmallVec<Symbol, 2>;
+
     using Empty = std::monostate;
     struct RequiredButMissing;
     struct TranslationUnit;
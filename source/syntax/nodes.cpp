@@ -1,80 +1,103 @@
 #include "nodes.hpp"
 #include "util.hpp"
 
+namespace tlc::syntax::detail {
+    /**
+     * Child list made of single nodes and lists of nodes, in order. Every
+     * subtree is moved; a braced list would copy them all, since the
+     * elements of an initializer_list are const.
+     */
+    template <typename... TChildren>
+    auto makeChildren(TChildren&&... children) -> Vec<Node> {
+        auto const count = []<typename T>(T const& child) -> szt {
+            if constexpr (std::same_as<T, Vec<Node>>) {
+                return child.size();
+            }
+            else {
+                return 1;
+            }
+        };
+
+        Vec<Node> nodes;
+        nodes.reserve((count(children) + ...));
+        ([&]<typename T>(T&& child) {
+            if constexpr (std::same_as<std::remove_cvref_t<T>, Vec<Node>>) {
+                nodes.append_range(child | rv::as_rvalue);
+            }
+            else {
+                nodes.emplace_back(std::forward<T>(child));
+            }
+        }(std::forward<TChildren>(children)), ...);
+        return nodes;
+    }
+}
+
 namespace tlc::syntax {
     namespace expr {
-        Integer::Integer(i64 const value, Location const location)
+        Integer::Integer(i64 const value, SourceLocation const location)
             : NodeBase{{}, location}, m_value{value} {}
 
-        Float::Float(f64 const value, Location const location)
+        Float::Float(f64 const value, SourceLocation const location)
             : NodeBase{{}, location}, m_value{value} {}
 
-        Boolean::Boolean(b8 const value, Location const location)
+        Boolean::Boolean(b8 const value, SourceLocation const location)
             : NodeBase{{}, location}, m_value{value} {}
 
         Identifier::Identifier(
-            Vec<Str> path, Location const location
+            Path path, SourceLocation const location
         ) : NodeBase{{}, location},
             IdentifierBase{std::move(path)} {}
 
-        Array::Array(Vec<Node> elements, Location const location)
+        Array::Array(Vec<Node> elements, SourceLocation const location)
             : NodeBase{std::move(elements), location} {}
 
         auto Array::size() const noexcept -> szt {
             return nChildren();
         }
 
-        Tuple::Tuple(Vec<Node> elements, Location const location)
+        Tuple::Tuple(Vec<Node> elements, SourceLocation const location)
             : NodeBase{std::move(elements), location} {}
 
         auto Tuple::size() const noexcept -> szt {
             return nChildren();
         }
 
-        FnApp::FnApp(Node callee, Node args, Location const location)
+        FnApp::FnApp(Node callee, Node args, SourceLocation const location)
             : NodeBase{
-                {std::move(callee), std::move(args)},
+                detail::makeChildren(std::move(callee), std::move(args)),
                 location
             } {}
 
         Subscript::Subscript(
-            Node collection, Node subscript, Location const location
+            Node collection, Node subscript, SourceLocation const location
         ): NodeBase{
-            {std::move(collection), std::move(subscript)},
+            detail::makeChildren(std::move(collection), std::move(subscript)),
             location
         } {}
 
         Prefix::Prefix(
-            Node operand, lexeme::Lexeme op, Location const location
-        ): NodeBase{{std::move(operand)}, location},
+            Node operand, lexeme::Lexeme op, SourceLocation const location
+        ): NodeBase{detail::makeChildren(std::move(operand)), location},
            m_op{std::move(op)} {}
 
         Binary::Binary(
-            Node lhs, Node rhs, lexeme::Lexeme op, Location const location
-        ) : NodeBase{{std::move(lhs), std::move(rhs)}, location},
+            Node lhs, Node rhs, lexeme::Lexeme op, SourceLocation const location
+        ) : NodeBase{detail::makeChildren(std::move(lhs), std::move(rhs)), location},
             m_op{std::move(op)} {}
 
         String::String(
-            Vec<Str> fragments, Vec<Node> placeholders, Location const location
+            Vec<Str> fragments, Vec<Node> placeholders, SourceLocation const location
         )
             : NodeBase{std::move(placeholders), location},
               m_fragments{std::move(fragments)} {}
 
-        RecordEntry::RecordEntry(Str key, Node value, Location const location)
-            : NodeBase{{std::move(value)}, location},
-              m_key{std::move(key)} {}
+        RecordEntry::RecordEntry(
+            Symbol const key, Node value, SourceLocation const location
+        ) : NodeBase{detail::makeChildren(std::move(value)), location}, m_key{key} {}
 
-        Record::Record(Node type, Vec<Node> entries, Location const location)
+        Record::Record(Node type, Vec<Node> entries, SourceLocation const location)
             : NodeBase{
-                {
-                    [&] {
-                        Vec<Node> nodes;
-                        nodes.reserve(entries.size() + 1);
-                        nodes.push_back(std::move(type));
-                        nodes.append_range(std::move(entries));
-                        return nodes;
-                    }()
-                },
+                detail::makeChildren(std::move(type), std::move(entries)),
                 location
             } {}
 
@@ -82,49 +105,46 @@ namespace tlc::syntax {
             return nChildren() - 1;
         }
 
-        Try::Try(Node expr, Location const location)
-            : NodeBase{{std::move(expr)}, location} {}
+        Try::Try(Node expr, SourceLocation const location)
+            : NodeBase{detail::makeChildren(std::move(expr)), location} {}
     }
 
     namespace type {
         Identifier::Identifier(
-            b8 const constant, Vec<Str> path, b8 const fundamental,
-            Location const location
+            b8 const constant, Path path, b8 const fundamental,
+            SourceLocation const location
         ): NodeBase{{}, location}, IdentifierBase{std::move(path)},
            m_fundamental{fundamental}, m_constant{constant} {}
 
         Array::Array(
-            Node type, Node sizes, Location const location
+            Node type, Node sizes, SourceLocation const location
         ): NodeBase{
-            [&] {
-                Vec<Node> nodes;
-                nodes.reserve(2);
-                nodes.push_back(std::move(type));
-                nodes.push_back(std::move(sizes));
-                return nodes;
-            }(),
+            detail::makeChildren(std::move(type), std::move(sizes)),
             location
         } {}
 
-        Tuple::Tuple(Vec<Node> types, Location const location)
+        Tuple::Tuple(Vec<Node> types, SourceLocation const location)
             : NodeBase{std::move(types), location} {}
 
         auto Tuple::size() const -> szt {
             return nChildren();
         }
 
-        Function::Function(Node args, Node result, Location const location)
-            : NodeBase{{std::move(args), std::move(result)}, location} {}
+        Function::Function(Node args, Node result, SourceLocation const location)
+            : NodeBase{
+                detail::makeChildren(std::move(args), std::move(result)),
+                location
+            } {}
 
-        Infer::Infer(Node expr, Location const location)
-            : NodeBase{{std::move(expr)}, location} {}
+        Infer::Infer(Node expr, SourceLocation const location)
+            : NodeBase{detail::makeChildren(std::move(expr)), location} {}
 
-        auto Infer::expr() const noexcept -> Node {
+        auto Infer::expr() const noexcept -> Node const& {
             return firstChild();
         }
 
         GenericArguments::GenericArguments(
-            Vec<Node> args, Location const location
+            Vec<Node> args, SourceLocation const location
         )
             : NodeBase{std::move(args), location} {}
 
@@ -132,29 +152,35 @@ namespace tlc::syntax {
             return nChildren();
         }
 
-        Generic::Generic(Node type, Node args, Location const location)
-            : NodeBase{{std::move(type), std::move(args)}, location} {}
+        Generic::Generic(Node type, Node args, SourceLocation const location)
+            : NodeBase{
+                detail::makeChildren(std::move(type), std::move(args)),
+                location
+            } {}
 
-        Binary::Binary(Node lhs, lexeme::Lexeme op, Node rhs, Location location)
-            : NodeBase{{std::move(lhs), std::move(rhs)}, std::move(location)},
+        Binary::Binary(Node lhs, lexeme::Lexeme op, Node rhs, SourceLocation location)
+            : NodeBase{
+                  detail::makeChildren(std::move(lhs), std::move(rhs)),
+                  std::move(location)
+              },
               m_op{std::move(op)} {}
     }
 
     namespace decl {
         Identifier::Identifier(
-            Str name, Node type, Location const location
-        ) : NodeBase{{std::move(type)}, location},
-            m_name{std::move(name)} {}
+            Symbol const name, Node type, SourceLocation const location
+        ) : NodeBase{detail::makeChildren(std::move(type)), location},
+            m_name{name} {}
 
 
         auto Identifier::inferred() const noexcept -> b8 {
             return isEmptyNode(firstChild());
         }
 
-        Tuple::Tuple(Vec<Node> decls, Location const location)
+        Tuple::Tuple(Vec<Node> decls, SourceLocation const location)
             : NodeBase{std::move(decls), location} {}
 
-        auto Tuple::decl(szt const index) const -> Node {
+        auto Tuple::decl(szt const index) const -> Node const& {
             return childAt(index);
         }
 
@@ -162,11 +188,12 @@ namespace tlc::syntax {
             return nChildren();
         }
 
-        GenericIdentifier::GenericIdentifier(Str name, Location const location)
-            : NodeBase{{}, location}, m_name{std::move(name)} {}
+        GenericIdentifier::GenericIdentifier(
+            Symbol const name, SourceLocation const location
+        ) : NodeBase{{}, location}, m_name{name} {}
 
         GenericParameters::GenericParameters(
-            Vec<Node> params, Location const location)
+            Vec<Node> params, SourceLocation const location)
             : NodeBase{std::move(params), location} {}
 
         auto GenericParameters::size() const -> szt {
@@ -174,53 +201,49 @@ namespace tlc::syntax {
         }
     }
 
-    stmt::Decl::Decl(Node decl, Node initializer, Location const location)
-        : NodeBase{{std::move(decl), std::move(initializer)}, location} {}
+    stmt::Decl::Decl(Node decl, Node initializer, SourceLocation const location)
+        : NodeBase{
+            detail::makeChildren(std::move(decl), std::move(initializer)),
+            location
+        } {}
 
     auto stmt::Decl::defaultInitialized() const -> bool {
         return isEmptyNode(lastChild());
     }
 
-    stmt::Return::Return(Node expr, Location const location)
-        : NodeBase{{std::move(expr)}, location} {}
+    stmt::Return::Return(Node expr, SourceLocation const location)
+        : NodeBase{detail::makeChildren(std::move(expr)), location} {}
 
-    stmt::Defer::Defer(Node stmt, Location const location)
-        : NodeBase{{std::move(stmt)}, location} {}
+    stmt::Defer::Defer(Node stmt, SourceLocation const location)
+        : NodeBase{detail::makeChildren(std::move(stmt)), location} {}
 
-    stmt::MatchCase::MatchCase(Node value, Node cond, Node stmt, Location const location)
+    stmt::MatchCase::MatchCase(Node value, Node cond, Node stmt, SourceLocation const location)
         : NodeBase{
-            {std::move(value), std::move(cond), std::move(stmt)},
+            detail::makeChildren(std::move(value), std::move(cond), std::move(stmt)),
             location
         } {}
 
-    stmt::Match::Match(Node expr, Vec<Node> cases, Node defaultStmt, Location const location)
+    stmt::Match::Match(Node expr, Vec<Node> cases, Node defaultStmt, SourceLocation const location)
         : NodeBase{
-            {
-                [&] {
-                    Vec<Node> nodes;
-                    nodes.reserve(cases.size() + 2);
-                    nodes.push_back(std::move(expr));
-                    nodes.append_range(std::move(cases));
-                    nodes.push_back(std::move(defaultStmt));
-                    return nodes;
-                }()
-            },
+            detail::makeChildren(
+                std::move(expr), std::move(cases), std::move(defaultStmt)
+            ),
             location
         } {}
 
-    stmt::Loop::Loop(Node decl, Node range, Node body, Location const location)
+    stmt::Loop::Loop(Node decl, Node range, Node body, SourceLocation const location)
         : NodeBase{
-            {std::move(decl), std::move(range), std::move(body)},
+            detail::makeChildren(std::move(decl), std::move(range), std::move(body)),
             location
         } {}
 
-    stmt::Conditional::Conditional(Node cond, Node then, Location const location)
+    stmt::Conditional::Conditional(Node cond, Node then, SourceLocation const location)
         : NodeBase{
-            {std::move(cond), std::move(then)},
+            detail::makeChildren(std::move(cond), std::move(then)),
             location
         } {}
 
-    stmt::Block::Block(Vec<Node> statements, Location const location)
+    stmt::Block::Block(Vec<Node> statements, SourceLocation const location)
         : NodeBase{std::move(statements), location} {}
 
     auto stmt::Block::size() const noexcept -> szt {
@@ -228,62 +251,58 @@ namespace tlc::syntax {
     }
 
     stmt::Assign::Assign(
-        Node lhs, Node rhs, lexeme::Lexeme op, Location const location
-    ): NodeBase{{std::move(lhs), std::move(rhs)}, location},
+        Node lhs, Node rhs, lexeme::Lexeme op, SourceLocation const location
+    ): NodeBase{detail::makeChildren(std::move(lhs), std::move(rhs)), location},
        m_op{std::move(op)} {}
 
-    stmt::Expression::Expression(Node expr, Location const location)
-        : NodeBase{{std::move(expr)}, location} {}
+    stmt::Expression::Expression(Node expr, SourceLocation const location)
+        : NodeBase{detail::makeChildren(std::move(expr)), location} {}
 
-    global::ModuleDecl::ModuleDecl(Node path, Location const location)
-        : NodeBase{{std::move(path)}, location} {}
+    global::ModuleDecl::ModuleDecl(Node path, SourceLocation const location)
+        : NodeBase{detail::makeChildren(std::move(path)), location} {}
 
     global::ImportDeclGroup::ImportDeclGroup(
-        Vec<Node> imports, Location location
+        Vec<Node> imports, SourceLocation location
     ) : NodeBase{std::move(imports), std::move(location)} {}
 
     auto global::ImportDeclGroup::size() const noexcept -> szt {
         return nChildren();
     }
 
-    global::ImportDecl::ImportDecl(Node alias, Node path, Location const location)
-        : NodeBase{{std::move(alias), std::move(path)}, location} {}
+    global::ImportDecl::ImportDecl(Node alias, Node path, SourceLocation const location)
+        : NodeBase{detail::makeChildren(std::move(alias), std::move(path)), location} {}
 
     global::FunctionPrototype::FunctionPrototype(
-        Node genericDecl, Str name, Node paramsDecl,
-        Node returnsDecl, Location const location
+        Node genericDecl, Symbol const name, Node paramsDecl,
+        Node returnsDecl, SourceLocation const location
     ): NodeBase{
-           {
+           detail::makeChildren(
                std::move(genericDecl), std::move(paramsDecl),
                std::move(returnsDecl)
-           },
+           ),
            location
        },
        m_name{std::move(name)} {}
 
     global::Function::Function(
         lexeme::Lexeme visibility, Node prototype, Node body,
-        Location const location
-    ): NodeBase{{std::move(prototype), std::move(body)}, location},
+        SourceLocation const location
+    ): NodeBase{detail::makeChildren(std::move(prototype), std::move(body)), location},
        m_visibility{std::move(visibility)} {}
 
     RequiredButMissing::RequiredButMissing()
         : NodeBase{{}, {}} {}
 
     TranslationUnit::TranslationUnit(
-        fs::path sourcePath, Node moduleDecl,
+        FileID const file, Node moduleDecl,
         Node importDeclGroup, Vec<Node> definitions
     ) : NodeBase{
-            [&] {
-                Vec<Node> nodes;
-                nodes.reserve(2 + definitions.size());
-                nodes.push_back(std::move(moduleDecl));
-                nodes.push_back(std::move(importDeclGroup));
-                nodes.append_range(std::move(definitions));
-                return nodes;
-            }(),
+            detail::makeChildren(
+                std::move(moduleDecl), std::move(importDeclGroup),
+                std::move(definitions)
+            ),
             {}
-        }, m_sourcePath{std::move(sourcePath)} {}
+        }, m_file{file} {}
 
     auto TranslationUnit::size() const noexcept -> szt {
         return nChildren();
@@ -8,7 +8,7 @@
 namespace tlc::syntax {
     namespace expr {
         struct Integer final : detail::NodeBase {
-            Integer(i64 value, Location location);
+            Integer(i64 value, SourceLocation location);
 
             [[nodiscard]] auto value() const noexcept -> i64 {
                 return m_value;
@@ -19,7 +19,7 @@ namespace tlc::syntax {
         };
 
         struct Float final : detail::NodeBase {
-            Float(f64 value, Location location);
+            Float(f64 value, SourceLocation location);
 
             [[nodiscard]] auto value() const noexcept -> double {
                 return m_value;
@@ -30,7 +30,7 @@ namespace tlc::syntax {
         };
 
         struct Boolean final : detail::NodeBase {
-            Boolean(b8 value, Location location);
+            Boolean(b8 value, SourceLocation location);
 
             [[nodiscard]] auto value() const noexcept -> b8 {
                 return m_value;
@@ -41,31 +41,31 @@ namespace tlc::syntax {
         };
 
         struct Identifier : detail::NodeBase, detail::IdentifierBase {
-            Identifier(Vec<Str> path, Location location);
+            Identifier(Path path, SourceLocation location);
         };
 
         struct Array final : detail::NodeBase {
-            Array(Vec<Node> elements, Location location);
+            Array(Vec<Node> elements, SourceLocation location);
 
             [[nodiscard]] auto size() const noexcept -> szt;
         };
 
         struct Tuple final : detail::NodeBase {
-            Tuple(Vec<Node> elements, Location location);
+            Tuple(Vec<Node> elements, SourceLocation location);
 
             [[nodiscard]] auto size() const noexcept -> szt;
         };
 
         struct FnApp final : detail::NodeBase {
-            FnApp(Node callee, Node args, Location location);
+            FnApp(Node callee, Node args, SourceLocation location);
         };
 
         struct Subscript final : detail::NodeBase {
-            Subscript(Node collection, Node subscript, Location location);
+            Subscript(Node collection, Node subscript, SourceLocation location);
         };
 
         struct Prefix final : detail::NodeBase {
-            Prefix(Node operand, lexeme::Lexeme op, Location location);
+            Prefix(Node operand, lexeme::Lexeme op, SourceLocation location);
 
             [[nodiscard]] auto op() const noexcept -> lexeme::Lexeme {
                 return m_op;
@@ -76,7 +76,7 @@ namespace tlc::syntax {
         };
 
         struct Binary final : detail::NodeBase {
-            Binary(Node lhs, Node rhs, lexeme::Lexeme op, Location location);
+            Binary(Node lhs, Node rhs, lexeme::Lexeme op, SourceLocation location);
 
             [[nodiscard]] auto op() const noexcept -> lexeme::Lexeme {
                 return m_op;
@@ -87,7 +87,7 @@ namespace tlc::syntax {
         };
 
         struct String final : detail::NodeBase {
-            String(Vec<Str> fragments, Vec<Node> placeholders, Location location);
+            String(Vec<Str> fragments, Vec<Node> placeholders, SourceLocation location);
 
             [[nodiscard]] auto fragments() const noexcept -> Span<Str const> {
                 return m_fragments;
@@ -106,31 +106,35 @@ namespace tlc::syntax {
         };
 
         struct RecordEntry final : detail::NodeBase {
-            RecordEntry(Str key, Node value, Location location);
+            RecordEntry(Symbol key, Node value, SourceLocation location);
 
             [[nodiscard]] auto key() const noexcept -> StrV {
+                return m_key.str();
+            }
+
+            [[nodiscard]] auto symbol() const noexcept -> Symbol {
                 return m_key;
             }
 
         private:
-            Str m_key;
+            Symbol m_key;
         };
 
         struct Record final : detail::NodeBase {
-            Record(Node type, Vec<Node> entries, Location location);
+            Record(Node type, Vec<Node> entries, SourceLocation location);
 
             [[nodiscard]] auto size() const noexcept -> szt;
         };
 
         struct Try final : detail::NodeBase {
-            Try(Node expr, Location location);
+            Try(Node expr, SourceLocation location);
         };
     }
 
     namespace type {
         struct Identifier : detail::NodeBase, detail::IdentifierBase {
             Identifier(
-                b8 constant, Vec<Str> path, b8 fundamental, Location location
+                b8 constant, Path path, b8 fundamental, SourceLocation location
             );
 
             [[nodiscard]] auto fundamental() const noexcept -> bool {
@@ -147,37 +151,37 @@ namespace tlc::syntax {
         };
 
         struct Array final : detail::NodeBase {
-            Array(Node type, Node sizes, Location location);
+            Array(Node type, Node sizes, SourceLocation location);
         };
 
         struct Tuple final : detail::NodeBase {
-            Tuple(Vec<Node> types, Location location);
+            Tuple(Vec<Node> types, SourceLocation location);
 
             [[nodiscard]] auto size() const -> szt;
         };
 
         struct Function final : detail::NodeBase {
-            Function(Node args, Node result, Location location);
+            Function(Node args, Node result, SourceLocation location);
         };
 
         struct Infer final : detail::NodeBase {
-            Infer(Node expr, Location location);
+            Infer(Node expr, SourceLocation location);
 
-            [[nodiscard]] auto expr() const noexcept -> Node;
+            [[nodiscard]] auto expr() const noexcept -> Node const&;
         };
 
         struct GenericArguments final : detail::NodeBase {
-            GenericArguments(Vec<Node> args, Location location);
+            GenericArguments(Vec<Node> args, SourceLocation location);
 
             [[nodiscard]] auto size() const noexcept -> szt;
         };
 
         struct Generic final : detail::NodeBase {
-            Generic(Node type, Node args, Location location);
+            Generic(Node type, Node args, SourceLocation location);
         };
 
         struct Binary final : detail::NodeBase {
-            Binary(Node lhs, lexeme::Lexeme op, Node rhs, Location location);
+            Binary(Node lhs, lexeme::Lexeme op, Node rhs, SourceLocation location);
 
             [[nodiscard]] auto op() const noexcept -> lexeme::Lexeme {
                 return m_op;
@@ -190,39 +194,47 @@ namespace tlc::syntax {
 
     namespace decl {
         struct Identifier final : detail::NodeBase {
-            Identifier(Str name, Node type, Location location);
+            Identifier(Symbol name, Node type, SourceLocation location);
+
+            [[nodiscard]] auto name() const noexcept -> StrV {
+                return m_name.str();
+            }
 
-            [[nodiscard]] auto name() const noexcept -> Str const& {
+            [[nodiscard]] auto symbol() const noexcept -> Symbol {
                 return m_name;
             }
 
             [[nodiscard]] auto inferred() const noexcept -> b8;
 
         private:
-            Str m_name;
+            Symbol m_name;
         };
 
         struct Tuple final : detail::NodeBase {
-            Tuple(Vec<Node> decls, Location location);
+            Tuple(Vec<Node> decls, SourceLocation location);
 
-            [[nodiscard]] auto decl(szt index) const -> Node;
+            [[nodiscard]] auto decl(szt index) const -> Node const&;
 
             [[nodiscard]] auto size() const -> szt;
         };
 
         struct GenericIdentifier final : detail::NodeBase {
-            GenericIdentifier(Str name, Location location);
+            GenericIdentifier(Symbol name, SourceLocation location);
 
             [[nodiscard]] auto name() const noexcept -> StrV {
+                return m_name.str();
+            }
+
+            [[nodiscard]] auto symbol() const noexcept -> Symbol {
                 return m_name;
             }
 
         private:
-            Str m_name;
+            Symbol m_name;
         };
 
         struct GenericParameters final : detail::NodeBase {
-            GenericParameters(Vec<Node> params, Location location);
+            GenericParameters(Vec<Node> params, SourceLocation location);
 
             [[nodiscard]] auto size() const -> szt;
         };
@@ -230,44 +242,44 @@ namespace tlc::syntax {
 
     namespace stmt {
         struct Decl final : detail::NodeBase {
-            Decl(Node decl, Node initializer, Location location);
+            Decl(Node decl, Node initializer, SourceLocation location);
 
             [[nodiscard]] auto defaultInitialized() const -> bool;
         };
 
         struct Return final : detail::NodeBase {
-            Return(Node expr, Location location);
+            Return(Node expr, SourceLocation location);
         };
 
         struct Defer final : detail::NodeBase {
-            Defer(Node stmt, Location location);
+            Defer(Node stmt, SourceLocation location);
         };
 
         struct MatchCase final : detail::NodeBase {
-            MatchCase(Node value, Node cond, Node stmt, Location location);
+            MatchCase(Node value, Node cond, Node stmt, SourceLocation location);
         };
 
         struct Match final : detail::NodeBase {
-            Match(Node expr, Vec<Node> cases, Node defaultStmt, Location location);
+            Match(Node expr, Vec<Node> cases, Node defaultStmt, SourceLocation location);
         };
 
 
         struct Loop final : detail::NodeBase {
-            Loop(Node decl, Node range, Node body, Location location);
+            Loop(Node decl, Node range, Node body, SourceLocation location);
         };
 
         struct Conditional final : detail::NodeBase {
-            Conditional(Node cond, Node then, Location location);
+            Conditional(Node cond, Node then, SourceLocation location);
         };
 
         struct Block final : detail::NodeBase {
-            Block(Vec<Node> statements, Location location);
+            Block(Vec<Node> statements, SourceLocation location);
 
             [[nodiscard]] auto size() const noexcept -> szt;
         };
 
         struct Assign final : detail::NodeBase {
-            Assign(Node lhs, Node rhs, lexeme::Lexeme op, Location location);
+            Assign(Node lhs, Node rhs, lexeme::Lexeme op, SourceLocation location);
 
             [[nodiscard]] auto op() const noexcept -> lexeme::Lexeme {
                 return m_op;
@@ -278,43 +290,47 @@ namespace tlc::syntax {
         };
 
         struct Expression final : detail::NodeBase {
-            Expression(Node expr, Location location);
+            Expression(Node expr, SourceLocation location);
         };
     }
 
     namespace global {
         struct ModuleDecl final : detail::NodeBase {
-            ModuleDecl(Node path, Location location);
+            ModuleDecl(Node path, SourceLocation location);
         };
 
         struct ImportDeclGroup final : detail::NodeBase {
-            ImportDeclGroup(Vec<Node> imports, Location location);
+            ImportDeclGroup(Vec<Node> imports, SourceLocation location);
 
             [[nodiscard]] auto size() const noexcept -> szt;
         };
 
         struct ImportDecl final : detail::NodeBase {
-            ImportDecl(Node alias, Node path, Location location);
+            ImportDecl(Node alias, Node path, SourceLocation location);
         };
 
         struct FunctionPrototype final : detail::NodeBase {
-            FunctionPrototype(Node genericDecl, Str name, Node paramsDecl,
-                              Node returnsDecl, Location location);
+            FunctionPrototype(Node genericDecl, Symbol name, Node paramsDecl,
+                              Node returnsDecl, SourceLocation location);
 
             [[nodiscard]] auto name() const noexcept -> StrV {
+                return m_name.str();
+            }
+
+            [[nodiscard]] auto symbol() const noexcept -> Symbol {
                 return m_name;
             }
 
         private:
-            Str m_name;
+            Symbol m_name;
         };
 
         struct Function final : detail::NodeBase {
             Function(lexeme::Lexeme visibility, Node prototype, Node body,
-                     Location location);
+                     SourceLocation location);
 
             [[nodiscard]] auto visibility() const noexcept
-                -> lexeme::Lexeme const& {
+                -> lexeme::Lexeme {
                 return m_visibility;
             }
 
@@ -329,18 +345,22 @@ namespace tlc::syntax {
 
     struct TranslationUnit final : detail::NodeBase {
         TranslationUnit(
-            fs::path sourcePath, Node moduleDecl,
+            FileID file, Node moduleDecl,
             Node importDeclGroup, Vec<Node> definitions
         );
 
-        [[nodiscard]] auto sourcePath() const noexcept -> fs::path const& {
-            return m_sourcePath;
+        [[nodiscard]] auto file() const noexcept -> FileID {
+            return m_file;
+        }
+
+        [[nodiscard]] auto sourcePath() const -> fs::path const& {
+            return SourceManager::instance().path(m_file);
         }
 
         [[nodiscard]] auto size() const noexcept -> szt;
 
     private:
-        fs::path m_sourcePath;
+        FileID m_file;
     };
 }
 
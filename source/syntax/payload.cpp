@@ -0,0 +1,222 @@
+#include "payload.hpp"
+#include "nodes.hpp"
+
+#include <bit>
+
+namespace tlc::syntax {
+    auto PayloadTable::store(Node const& node) -> Payload {
+        return std::visit([this]<typename T>(T const& alternative) {
+            return storeAs(alternative);
+        }, node);
+    }
+
+    auto PayloadTable::make(
+        szt const kind, Payload const& payload, SourceLocation const location,
+        Vec<Node> children
+    ) const -> Node {
+        using Make = Node (PayloadTable::*)(
+            Payload const&, SourceLocation, Vec<Node>
+        ) const;
+        static constexpr auto makers = []<szt... I>(std::index_sequence<I...>) {
+            return Arr<Make, sizeof...(I)>{
+                &PayloadTable::makeAs<std::variant_alternative_t<I, Node>>...
+            };
+        }(std::make_index_sequence<std::variant_size_v<Node>>{});
+
+        return (this->*makers[kind])(payload, location, std::move(children));
+    }
+
+    auto PayloadTable::integer(Payload const& payload) const noexcept -> i64 {
+        return std::bit_cast<i64>(m_numbers[payload.first]);
+    }
+
+    auto PayloadTable::floating(Payload const& payload) const noexcept -> f64 {
+        return std::bit_cast<f64>(m_numbers[payload.first]);
+    }
+
+    auto PayloadTable::bytes() const noexcept -> szt {
+        return m_symbols.capacity() * sizeof(Symbol) +
+            m_numbers.capacity() * sizeof(u64) +
+            m_fragments.capacity() * sizeof(Pair<u32, u32>) +
+            m_text.capacity();
+    }
+
+    auto PayloadTable::clear() noexcept -> void {
+        m_symbols.clear();
+        m_numbers.clear();
+        m_fragments.clear();
+        m_text.clear();
+    }
+
+    template <typename T>
+    auto PayloadTable::storeAs(T const& node) -> Payload {
+        if constexpr (IsEither<T, expr::Integer, expr::Float>) {
+            m_numbers.push_back(std::bit_cast<u64>(node.value()));
+            return {.first = static_cast<u32>(m_numbers.size() - 1), .size = 1};
+        }
+        else if constexpr (std::same_as<T, expr::Boolean>) {
+            return {.flags = node.value()};
+        }
+        else if constexpr (std::same_as<T, expr::Identifier>) {
+            return storeSymbols(node.segments());
+        }
+        else if constexpr (std::same_as<T, type::Identifier>) {
+            auto payload = storeSymbols(node.segments());
+            payload.flags = static_cast<u8>(
+                (node.constant() ? 1 : 0) | (node.fundamental() ? 2 : 0)
+            );
+            return payload;
+        }
+        else if constexpr (std::same_as<T, expr::String>) {
+            Payload const payload{
+                .first = static_cast<u32>(m_fragments.size()),
+                .size = static_cast<u32>(node.fragments().size()),
+            };
+            for (auto const& fragment : node.fragments()) {
+                m_fragments.emplace_back(
+                    static_cast<u32>(m_text.size()),
+                    static_cast<u32>(fragment.size())
+                );
+                m_text += fragment;
+            }
+            return payload;
+        }
+        else if constexpr (IsEither<T,
+            expr::RecordEntry, decl::Identifier, decl::GenericIdentifier,
+            global::FunctionPrototype
+        >) {
+            auto const symbol = node.symbol();
+            return storeSymbols({&symbol, 1});
+        }
+        else if constexpr (requires { node.op(); }) {
+            return {.op = node.op()};
+        }
+        else if constexpr (std::same_as<T, global::Function>) {
+            return {.op = node.visibility()};
+        }
+        else if constexpr (std::same_as<T, TranslationUnit>) {
+            return {.first = node.file()};
+        }
+        else {
+            return {};
+        }
+    }
+
+    template <typename T>
+    auto PayloadTable::makeAs(
+        Payload const& payload, SourceLocation const location, Vec<Node> children
+    ) const -> Node {
+        auto const take = [&](szt const index) -> Node {
+            return std::move(children[index]);
+        };
+        auto const range = [&](szt const first, szt const last) {
+            return Vec<Node>{
+                std::make_move_iterator(children.begin() + static_cast<i64>(first)),
+                std::make_move_iterator(children.begin() + static_cast<i64>(last))
+            };
+        };
+        auto const n = children.size();
+        auto const path = [&](Payload const& identifier) {
+            return Path{segments(identifier)};
+        };
+
+        if constexpr (std::same_as<T, Empty>) {
+            return Empty{};
+        }
+        else if constexpr (std::same_as<T, expr::Integer>) {
+            return T{integer(payload), location};
+        }
+        else if constexpr (std::same_as<T, expr::Float>) {
+            return T{floating(payload), location};
+        }
+        else if constexpr (std::same_as<T, expr::Boolean>) {
+            return T{payload.flags != 0, location};
+        }
+        else if constexpr (std::same_as<T, expr::Identifier>) {
+            return T{path(payload), location};
+        }
+        else if constexpr (std::same_as<T, type::Identifier>) {
+            return T{
+                (payload.flags & 1) != 0, path(payload),
+                (payload.flags & 2) != 0, location
+            };
+        }
+        else if constexpr (std::same_as<T, expr::String>) {
+            Vec<Str> fragments;
+            fragments.reserve(payload.size);
+            for (auto const [offset, length] : Span<Pair<u32, u32> const>{
+                     m_fragments
+                 }.subspan(payload.first, payload.size)) {
+                fragments.emplace_back(StrV{m_text}.substr(offset, length));
+            }
+            return T{std::move(fragments), std::move(children), location};
+        }
+        else if constexpr (IsEither<T,
+            expr::Array, expr::Tuple, type::Tuple, type::GenericArguments,
+            decl::Tuple, decl::GenericParameters, stmt::Block,
+            global::ImportDeclGroup
+        >) {
+            return T{std::move(children), location};
+        }
+        else if constexpr (IsEither<T,
+            expr::FnApp, expr::Subscript, type::Array, type::Function,
+            type::Generic, stmt::Decl, stmt::Conditional, global::ImportDecl
+        >) {
+            return T{take(0), take(1), location};
+        }
+        else if constexpr (IsEither<T,
+            expr::Try, type::Infer, stmt::Return, stmt::Defer,
+            stmt::Expression, global::ModuleDecl
+        >) {
+            return T{take(0), location};
+        }
+        else if constexpr (IsEither<T, stmt::MatchCase, stmt::Loop>) {
+            return T{take(0), take(1), take(2), location};
+        }
+        else if constexpr (std::same_as<T, expr::Prefix>) {
+            return T{take(0), payload.op, location};
+        }
+        else if constexpr (IsEither<T, expr::Binary, stmt::Assign>) {
+            return T{take(0), take(1), payload.op, location};
+        }
+        else if constexpr (std::same_as<T, type::Binary>) {
+            return T{take(0), payload.op, take(1), location};
+        }
+        else if constexpr (IsEither<T, expr::RecordEntry, decl::Identifier>) {
+            return T{m_symbols[payload.first], take(0), location};
+        }
+        else if constexpr (std::same_as<T, expr::Record>) {
+            return T{take(0), range(1, n), location};
+        }
+        else if constexpr (std::same_as<T, decl::GenericIdentifier>) {
+            return T{m_symbols[payload.first], location};
+        }
+        else if constexpr (std::same_as<T, stmt::Match>) {
+            return T{take(0), range(1, n - 1), take(n - 1), location};
+        }
+        else if constexpr (std::same_as<T, global::FunctionPrototype>) {
+            return T{
+                take(0), m_symbols[payload.first], take(1), take(2), location
+            };
+        }
+        else if constexpr (std::same_as<T, global::Function>) {
+            return T{payload.op, take(0), take(1), location};
+        }
+        else if constexpr (std::same_as<T, RequiredButMissing>) {
+            return T{};
+        }
+        else {
+            static_assert(std::same_as<T, TranslationUnit>);
+            return T{payload.first, take(0), take(1), range(2, n)};
+        }
+    }
+
+    auto PayloadTable::storeSymbols(Span<Symbol const> const symbols) -> Payload {
+        Payload const payload{
+            .first = static_cast<u32>(m_symbols.size()),
+            .size = static_cast<u32>(symbols.size()),
+        };
+        m_symbols.append_range(symbols);
+        return payload;
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef TLC_SYNTAX_PAYLOAD_HPP
+#define TLC_SYNTAX_PAYLOAD_HPP
+
+#include "core/core.hpp"
+#include "forward.hpp"
+#include "token/token.hpp"
+
+namespace tlc::syntax {
+    // index of a node in an Arena
+    using NodeId = u32;
+
+    // index of {T} among the alternatives of syntax::Node
+    template <typename T>
+    inline constexpr szt nodeIndex = []<szt... I>(std::index_sequence<I...>) {
+        szt index = std::variant_npos;
+        static_cast<void>((
+            (std::same_as<T, std::variant_alternative_t<I, Node>> && (index = I, true))
+            || ...
+        ));
+        return index;
+    }(std::make_index_sequence<std::variant_size_v<Node>>{});
+
+    /**
+     * Data of a node besides its kind, location and children. {first} and
+     * {size} locate the entries of the node in the side tables of its
+     * PayloadTable, {op} is an operator or the visibility of a function and
+     * {flags} holds boolean literals and attributes.
+     */
+    struct Payload {
+        u32 first{};
+        u32 size{};
+        lexeme::Lexeme op = lexeme::empty;
+        u8 flags{};
+
+        constexpr auto operator==(Payload const&) const noexcept -> bool = default;
+    };
+
+    /**
+     * Side tables for the payloads of the nodes of a flattened tree: numeric
+     * literals, path segments and names, and string fragments.
+     */
+    class PayloadTable final {
+    public:
+        // the payload of {node}, regardless of its children
+        auto store(Node const& node) -> Payload;
+
+        /**
+         * Rebuilds a node of alternative {kind} of syntax::Node from its
+         * payload and its children, which must already be materialized.
+         */
+        [[nodiscard]] auto make(
+            szt kind, Payload const& payload, SourceLocation location,
+            Vec<Node> children
+        ) const -> Node;
+
+        [[nodiscard]] auto integer(Payload const& payload) const noexcept -> i64;
+
+        [[nodiscard]] auto floating(Payload const& payload) const noexcept -> f64;
+
+        // path segments, or the name of a named node
+        [[nodiscard]] auto segments(Payload const& payload) const noexcept
+            -> Span<Symbol const> {
+            return Span<Symbol const>{m_symbols}
+                .subspan(payload.first, payload.size);
+        }
+
+        [[nodiscard]] auto bytes() const noexcept -> szt;
+
+        auto clear() noexcept -> void;
+
+    private:
+        template <typename T>
+        auto storeAs(T const& node) -> Payload;
+
+        template <typename T>
+        [[nodiscard]] auto makeAs(
+            Payload const& payload, SourceLocation location, Vec<Node> children
+        ) const -> Node;
+
+        auto storeSymbols(Span<Symbol const> symbols) -> Payload;
+
+    private:
+        Vec<Symbol> m_symbols{};
+        Vec<u64> m_numbers{};
+        // string fragments as offset and length into m_text
+        Vec<Pair<u32, u32>> m_fragments{};
+        Str m_text{};
+    };
+}
+
+#endif // TLC_SYNTAX_PAYLOAD_HPP
@@ -6,5 +6,7 @@
 #include "nodes.hpp"
 #include "visitor.hpp"
 #include "util.hpp"
+#include "payload.hpp"
+#include "arena.hpp"
 
 #endif // TLC_SYNTAX_HPP
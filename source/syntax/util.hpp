@@ -22,18 +22,33 @@ namespace tlc::syntax {
     //                        (std::same_as<T, U> || ...)
     //                        || std::same_as<Node, T>;
 
+    // the {TNode} held by {node} without copying it, or nullptr if {node}
+    // holds another alternative
+    template <IsStrictlyASTNode TNode>
+    auto astGetIf(Node const& node) noexcept -> TNode const* {
+        return std::get_if<TNode>(&node);
+    }
+
+    template <IsStrictlyASTNode TNode>
+    auto astGetIf(Node& node) noexcept -> TNode* {
+        return std::get_if<TNode>(&node);
+    }
+
+    // copies the whole subtree, prefer astGetIf unless a copy is needed
     template <IsASTNode TNode>
     auto astCast(Node const& node, Str const& filepath = "") -> TNode {
         if constexpr (std::same_as<TNode, Node>) {
             return node;
         }
-
-        if (!std::holds_alternative<TNode>(node)) {
-            throw filepath.empty()
-                      ? InternalException(filepath, "invalid AST-node cast")
-                      : InternalException("invalid AST-node cast");
+        else {
+            auto const* result = astGetIf<TNode>(node);
+            if (result == nullptr) {
+                throw filepath.empty()
+                          ? InternalException(filepath, "invalid AST-node cast")
+                          : InternalException("invalid AST-node cast");
+            }
+            return *result;
         }
-        return std::get<TNode>(node);
     }
 
     template <std::derived_from<detail::NodeBase>... TNode>
@@ -47,21 +62,174 @@ namespace tlc::syntax {
         Prefix, Postfix, Binary, Ternary
     };
 
-#ifdef TLC_CONFIG_BUILD_TESTS
-    extern const HashMap<lexeme::Lexeme, OpPrecedence> prefixOpPrecedenceTable;
-    extern const HashMap<lexeme::Lexeme, OpPrecedence> binaryOpPrecedenceTable;
-    extern const HashSet<lexeme::Lexeme> binaryTypeOpTable;
-    extern const HashSet<lexeme::Lexeme> leftAssociativeOps;
-    extern const HashSet<lexeme::Lexeme> assignmentOps;
-#endif // TLC_CONFIG_BUILD_TESTS
-
-    auto isPrefixOperator(lexeme::Lexeme const& lexeme) -> bool;
-    auto isPostfixStart(lexeme::Lexeme const& lexeme) -> bool;
-    auto isBinaryOperator(lexeme::Lexeme const& lexeme) -> bool;
-    auto isBinaryTypeOperator(lexeme::Lexeme const& lexeme) -> bool;
-    auto opPrecedence(lexeme::Lexeme const& lexeme, EOperator opType) -> OpPrecedence;
-    auto isLeftAssociative(lexeme::Lexeme const& lexeme) -> bool;
-    auto isAssignmentOperator(lexeme::Lexeme const& lexeme) -> bool;
+    // todo: check C operator precedence
+    inline constexpr auto prefixOpPrecedenceTable =
+        std::to_array<Pair<lexeme::Lexeme, OpPrecedence>>({
+            {lexeme::exclaim, 40},
+            {lexeme::tilde, 41},
+            {lexeme::plus, 42},
+            {lexeme::minus, 43},
+            {lexeme::hash, 44},
+            {lexeme::dot3, 45},
+            {lexeme::ampersand, 46},
+        });
+
+    inline constexpr auto binaryOpPrecedenceTable =
+        std::to_array<Pair<lexeme::Lexeme, OpPrecedence>>({
+            {lexeme::bar2, 10},
+            {lexeme::ampersand2, 12},
+            {lexeme::bar, 14},
+            {lexeme::hat, 16},
+            {lexeme::ampersand, 18},
+            {lexeme::exclaimEqual, 20},
+            {lexeme::equal2, 20},
+            {lexeme::greaterEqual, 22},
+            {lexeme::lessEqual, 22},
+            {lexeme::greater, 22},
+            {lexeme::less, 22},
+            {lexeme::less2, 24},
+            {lexeme::greater2, 24},
+            {lexeme::dot2, 26},
+            {lexeme::minus, 28},
+            {lexeme::plus, 28},
+            {lexeme::fwdSlash, 30},
+            {lexeme::star, 30},
+            {lexeme::star2, 32},
+            {lexeme::barGreater, 34},
+        });
+
+    inline constexpr auto binaryTypeOpTable = std::to_array({
+        lexeme::bar, lexeme::ampersand,
+        lexeme::equal2, lexeme::exclaimEqual,
+        lexeme::barGreater,
+    });
+
+    inline constexpr auto leftAssociativeOps = std::to_array({
+        lexeme::bar2, lexeme::ampersand2, lexeme::bar, lexeme::hat,
+        lexeme::ampersand, lexeme::exclaimEqual, lexeme::equal2,
+        lexeme::greaterEqual, lexeme::lessEqual, lexeme::greater,
+        lexeme::less, lexeme::less2, lexeme::greater2, lexeme::plus,
+        lexeme::minus, lexeme::star, lexeme::fwdSlash, lexeme::star2,
+        lexeme::barGreater, lexeme::dot2,
+    });
+
+    inline constexpr auto assignmentOps = std::to_array({
+        lexeme::plusEqual, lexeme::minusEqual, lexeme::starEqual,
+        lexeme::fwdSlashEqual, lexeme::percentEqual, lexeme::star2Equal,
+        lexeme::ampersandEqual, lexeme::barEqual, lexeme::hatEqual,
+        lexeme::less2Equal, lexeme::greater2Equal, lexeme::colonEqual,
+    });
+
+    inline constexpr auto postfixStartOps = std::to_array({
+        lexeme::leftParen, lexeme::leftBracket,
+    });
+
+    namespace detail {
+        /**
+         * Everything the parser asks about an operator lexeme, so that one
+         * table entry answers all the questions below. {flags} holds the
+         * fixities and associativity, the precedences are 0 for lexemes
+         * that are not such an operator.
+         */
+        struct OperatorInfo {
+            enum EFlag : u8 {
+                Prefix = 1 << 0,
+                Binary = 1 << 1,
+                BinaryType = 1 << 2,
+                LeftAssociative = 1 << 3,
+                Assignment = 1 << 4,
+                PostfixStart = 1 << 5,
+            };
+
+            u8 flags{};
+            u8 prefixPrecedence{};
+            u8 binaryPrecedence{};
+
+            [[nodiscard]] constexpr auto has(EFlag const flag) const noexcept -> b8 {
+                return (flags & flag) != 0;
+            }
+        };
+
+        // indexed by Lexeme::EType, built from the tables above
+        inline constexpr auto operatorTable = [] {
+            Arr<OperatorInfo, lexeme::Lexeme::typeCount> table{};
+            auto const set = [&](lexeme::Lexeme const lexeme,
+                                 OperatorInfo::EFlag const flag) -> OperatorInfo& {
+                auto& info = table[static_cast<szt>(lexeme.type())];
+                info.flags = static_cast<u8>(info.flags | flag);
+                return info;
+            };
+
+            for (auto const& [lexeme, precedence] : prefixOpPrecedenceTable) {
+                set(lexeme, OperatorInfo::Prefix).prefixPrecedence =
+                    static_cast<u8>(precedence);
+            }
+            for (auto const& [lexeme, precedence] : binaryOpPrecedenceTable) {
+                set(lexeme, OperatorInfo::Binary).binaryPrecedence =
+                    static_cast<u8>(precedence);
+            }
+            for (auto const lexeme : binaryTypeOpTable) {
+                set(lexeme, OperatorInfo::BinaryType);
+            }
+            for (auto const lexeme : leftAssociativeOps) {
+                set(lexeme, OperatorInfo::LeftAssociative);
+            }
+            for (auto const lexeme : assignmentOps) {
+                set(lexeme, OperatorInfo::Assignment);
+            }
+            for (auto const lexeme : postfixStartOps) {
+                set(lexeme, OperatorInfo::PostfixStart);
+            }
+            return table;
+        }();
+
+        [[nodiscard]] constexpr auto operatorInfo(lexeme::Lexeme const lexeme) noexcept
+            -> OperatorInfo {
+            return operatorTable[static_cast<szt>(lexeme.type())];
+        }
+    }
+
+    constexpr auto isPrefixOperator(lexeme::Lexeme const lexeme) noexcept -> bool {
+        return detail::operatorInfo(lexeme).has(detail::OperatorInfo::Prefix);
+    }
+
+    constexpr auto isPostfixStart(lexeme::Lexeme const lexeme) noexcept -> bool {
+        return detail::operatorInfo(lexeme).has(detail::OperatorInfo::PostfixStart);
+    }
+
+    constexpr auto isBinaryOperator(lexeme::Lexeme const lexeme) noexcept -> bool {
+        return detail::operatorInfo(lexeme).has(detail::OperatorInfo::Binary);
+    }
+
+    constexpr auto isBinaryTypeOperator(lexeme::Lexeme const lexeme) noexcept
+        -> bool {
+        return detail::operatorInfo(lexeme).has(detail::OperatorInfo::BinaryType);
+    }
+
+    // 0 if {lexeme} is not an operator of kind {opType}
+    constexpr auto opPrecedence(
+        lexeme::Lexeme const lexeme, EOperator const opType
+    ) noexcept -> OpPrecedence {
+        switch (opType) {
+        case EOperator::Prefix: return detail::operatorInfo(lexeme).prefixPrecedence;
+        case EOperator::Binary: return detail::operatorInfo(lexeme).binaryPrecedence;
+        default: return 0;
+        }
+    }
+
+    constexpr auto isLeftAssociative(lexeme::Lexeme const lexeme) noexcept -> bool {
+        return detail::operatorInfo(lexeme).has(detail::OperatorInfo::LeftAssociative);
+    }
+
+    constexpr auto isAssignmentOperator(lexeme::Lexeme const lexeme) noexcept
+        -> bool {
+        return detail::operatorInfo(lexeme).has(detail::OperatorInfo::Assignment);
+    }
+
+    static_assert(sizeof(detail::OperatorInfo) == 3);
+    static_assert(isBinaryOperator(lexeme::plus) && isPrefixOperator(lexeme::plus));
+    static_assert(opPrecedence(lexeme::star, EOperator::Binary) == 30);
+    static_assert(!isBinaryOperator(lexeme::identifier));
 }
 
 #endif // TLC_SYNTAX_UTIL_HPP
@@ -6,7 +6,7 @@
 namespace tlc::lexeme {
     class Lexeme final {
     public: // private is fine, added to hide linter errors
-        enum class EType {
+        enum class EType : u8 {
             // Misc
             Empty, Invalid,
 
@@ -23,7 +23,9 @@ namespace tlc::lexeme {
             // Literals
             Identifier, FundamentalType, UserDefinedType,
             Integer2Literal, Integer8Literal, Integer10Literal, Integer16Literal,
-            FloatLiteral, StringFragment, StringPlaceholder,
+            FloatLiteral, StringFragment,
+            // around the tokens of a string placeholder, spelled '{' and '}'
+            PlaceholderBegin, PlaceholderEnd,
 
             // Symbols
             /* Single character */ LeftParen, RightParen, LeftBracket, RightBracket, LeftBrace,
@@ -40,161 +42,460 @@ namespace tlc::lexeme {
     public:
         using enum EType;
 
-        explicit constexpr Lexeme(EType const type, StrV const str = "")
-            : m_type{type}, m_str{str} {}
+        static constexpr szt typeCount = static_cast<szt>(Star2Equal) + 1;
 
-        auto constexpr operator==(Lexeme const& other) const -> b8 {
+        explicit constexpr Lexeme(EType const type) noexcept
+            : m_type{type} {}
+
+        auto constexpr operator==(Lexeme const other) const -> b8 {
             return m_type == other.m_type;
         }
 
-        auto constexpr operator!=(Lexeme const& other) const -> b8 {
+        auto constexpr operator!=(Lexeme const other) const -> b8 {
             return !(*this == other);
         }
 
         [[nodiscard]] auto constexpr type() const -> EType { return m_type; }
-        [[nodiscard]] auto constexpr str() const -> StrV { return m_str; }
+        [[nodiscard]] auto constexpr str() const -> StrV;
 
     private:
         EType m_type;
-        Str m_str;
     };
 
+    static_assert(sizeof(Lexeme) == 1);
+    static_assert(std::is_trivially_copyable_v<Lexeme>);
+
+    constexpr auto keywordSpellings = std::to_array<Pair<Lexeme::EType, StrV>>({
+        {Lexeme::Module, "module"},
+        {Lexeme::Import, "import"},
+        {Lexeme::Pub, "pub"},
+        {Lexeme::Prv, "prv"},
+        {Lexeme::Isolated, "isolated"},
+        {Lexeme::Static, "static"},
+        {Lexeme::Let, "let"},
+        {Lexeme::Fn, "fn"},
+        {Lexeme::Trait, "trait"},
+        {Lexeme::Type, "type"},
+        {Lexeme::Enum, "enum"},
+        {Lexeme::Flag, "flag"},
+        {Lexeme::For, "for"},
+        {Lexeme::Match, "match"},
+        {Lexeme::Return, "return"},
+        {Lexeme::Defer, "defer"},
+        {Lexeme::Break, "break"},
+        {Lexeme::Continue, "continue"},
+        {Lexeme::Try, "try"},
+        {Lexeme::In, "in"},
+        {Lexeme::When, "when"},
+        {Lexeme::Impl, "impl"},
+        {Lexeme::Self, "self"},
+        {Lexeme::Main, "main"},
+        {Lexeme::True, "true"},
+        {Lexeme::False, "false"},
+    });
+
+    constexpr auto symbolSpellings = std::to_array<Pair<Lexeme::EType, StrV>>({
+        {Lexeme::LeftParen, "("},
+        {Lexeme::RightParen, ")"},
+        {Lexeme::LeftBracket, "["},
+        {Lexeme::RightBracket, "]"},
+        {Lexeme::LeftBrace, "{"},
+        {Lexeme::RightBrace, "}"},
+        {Lexeme::Hash, "#"},
+        {Lexeme::Dot, "."},
+        {Lexeme::Comma, ","},
+        {Lexeme::Colon, ":"},
+        {Lexeme::Semicolon, ";"},
+        {Lexeme::Star, "*"},
+        {Lexeme::Ampersand, "&"},
+        {Lexeme::Bar, "|"},
+        {Lexeme::Plus, "+"},
+        {Lexeme::Minus, "-"},
+        {Lexeme::FwdSlash, "/"},
+        {Lexeme::Percent, "%"},
+        {Lexeme::Exclaim, "!"},
+        {Lexeme::Equal, "="},
+        {Lexeme::Greater, ">"},
+        {Lexeme::Less, "<"},
+        {Lexeme::QMark, "?"},
+        {Lexeme::Hat, "^"},
+        {Lexeme::Tilde, "~"},
+        {Lexeme::Dollar, "$"},
+        {Lexeme::At, "@"},
+        {Lexeme::Anonymous, "_"},
+        {Lexeme::Star2, "**"},
+        {Lexeme::Ampersand2, "&&"},
+        {Lexeme::Bar2, "||"},
+        {Lexeme::Plus2, "++"},
+        {Lexeme::Minus2, "--"},
+        {Lexeme::Exclaim2, "!!"},
+        {Lexeme::Equal2, "=="},
+        {Lexeme::Greater2, ">>"},
+        {Lexeme::Less2, "<<"},
+        {Lexeme::QMark2, "??"},
+        {Lexeme::ExclaimEqual, "!="},
+        {Lexeme::StarEqual, "*="},
+        {Lexeme::AmpersandEqual, "&="},
+        {Lexeme::BarEqual, "|="},
+        {Lexeme::FwdSlashEqual, "/="},
+        {Lexeme::PercentEqual, "%="},
+        {Lexeme::GreaterEqual, ">="},
+        {Lexeme::LessEqual, "<="},
+        {Lexeme::PlusEqual, "+="},
+        {Lexeme::MinusEqual, "-="},
+        {Lexeme::ColonEqual, ":="},
+        {Lexeme::BarGreater, "|>"},
+        {Lexeme::MinusGreater, "->"},
+        {Lexeme::LessMinus, "<-"},
+        {Lexeme::Dot2, ".."},
+        {Lexeme::HatEqual, "^="},
+        {Lexeme::EqualGreater, "=>"},
+        {Lexeme::Dot3, "..."},
+        {Lexeme::Greater2Equal, ">>="},
+        {Lexeme::Less2Equal, "<<="},
+        {Lexeme::Star2Equal, "**="},
+    });
+
+    /**
+     * Symbols that have a spelling but are not lexed as one token: "!!x"
+     * is two negations and "a<-1" a comparison with a negative number.
+     */
+    constexpr auto unlexedSymbols = std::to_array<Lexeme::EType>({
+        Lexeme::Exclaim2, Lexeme::LessMinus,
+    });
+
+    [[nodiscard]] constexpr auto isLexedSymbol(Lexeme::EType const type)
+        -> bool {
+        return rng::find(unlexedSymbols, type) == unlexedSymbols.end();
+    }
+
+    // indexed by EType, empty for lexemes other than keywords and symbols
+    constexpr auto spellingTable = [] {
+        Arr<StrV, Lexeme::typeCount> table{};
+        table.fill("");
+        for (auto const& [type, str] : keywordSpellings) {
+            table[static_cast<szt>(type)] = str;
+        }
+        for (auto const& [type, str] : symbolSpellings) {
+            table[static_cast<szt>(type)] = str;
+        }
+        return table;
+    }();
+
+    constexpr auto Lexeme::str() const -> StrV {
+        return spellingTable[static_cast<szt>(m_type)];
+    }
+
+    constexpr auto fundamentalTypeSpellings = std::to_array<StrV>({
+        "Int", "Float", "Bool", "Char", "Void", "String", "Any", "Opt",
+        "Own", "Ref", "Obs",
+    });
+
+    namespace detail {
+        /**
+         * Hash of a name from its length, first, middle and last characters.
+         * Length, first and last alone cannot tell "type" from "true". The
+         * multipliers are searched at compile time so that keywords and
+         * fundamental types do not collide.
+         */
+        struct ReservedNameHash {
+            static constexpr szt tableSize = 128;
+
+            u32 middle{}, last{};
+
+            constexpr auto operator()(StrV const name) const noexcept -> szt {
+                return (name.size() + static_cast<u8>(name.front()) +
+                    static_cast<u8>(name[name.size() / 2]) * middle +
+                    static_cast<u8>(name.back()) * last) % tableSize;
+            }
+        };
+
+        struct ReservedName {
+            StrV str;
+            Lexeme::EType type;
+        };
+
+        constexpr auto reservedNames = [] {
+            Arr<ReservedName, keywordSpellings.size() +
+                fundamentalTypeSpellings.size()> names{};
+            szt i = 0;
+            for (auto const& [type, str] : keywordSpellings) {
+                names[i++] = {str, type};
+            }
+            for (auto const str : fundamentalTypeSpellings) {
+                names[i++] = {str, Lexeme::FundamentalType};
+            }
+            return names;
+        }();
+
+        constexpr auto reservedNameHash = [] {
+            for (u32 middle = 0; middle < 32; ++middle) {
+                for (u32 last = 0; last < 32; ++last) {
+                    ReservedNameHash const hash{middle, last};
+                    Arr<b8, ReservedNameHash::tableSize> used{};
+                    auto perfect = true;
+                    for (auto const& name : reservedNames) {
+                        auto& slot = used[hash(name.str)];
+                        perfect = perfect && !slot;
+                        slot = true;
+                    }
+                    if (perfect) {
+                        return hash;
+                    }
+                }
+            }
+            return ReservedNameHash{};
+        }();
+
+        constexpr auto reservedNameTable = [] {
+            Arr<ReservedName, ReservedNameHash::tableSize> table{};
+            table.fill({"", Lexeme::Empty});
+            for (auto const& name : reservedNames) {
+                table[reservedNameHash(name.str)] = name;
+            }
+            return table;
+        }();
+
+        static_assert(rng::all_of(reservedNames, [](auto const& name) {
+            return reservedNameTable[reservedNameHash(name.str)].str == name.str;
+        }), "keywords and fundamental types must not collide");
+    }
+
+    // the keyword or fundamental type spelled {name}, empty for other names
+    constexpr auto reservedName(StrV const name) -> Lexeme {
+        if (name.empty()) {
+            return Lexeme{Lexeme::Empty};
+        }
+
+        auto const& [str, type] = detail::reservedNameTable[
+            detail::reservedNameHash(name)
+        ];
+        return Lexeme{str == name ? type : Lexeme::Empty};
+    }
+
+    namespace detail {
+        // states of a trie over the lexed symbolSpellings, the start state
+        // included
+        constexpr auto symbolStateCount = [] {
+            Vec<StrV> prefixes;
+            for (auto const& spelling : symbolSpellings) {
+                if (!isLexedSymbol(spelling.first)) {
+                    continue;
+                }
+                for (szt length = 1; length <= spelling.second.size(); ++length) {
+                    prefixes.push_back(spelling.second.substr(0, length));
+                }
+            }
+            rng::sort(prefixes);
+            prefixes.erase(rng::unique(prefixes).begin(), prefixes.end());
+            return prefixes.size() + 1;
+        }();
+    }
+
+    /**
+     * Deterministic automaton over the symbolSpellings that are lexed. Every state has a
+     * transition for each byte, state 0 being both the start state and the
+     * dead end, and accepts the symbol spelled on the way to it if any.
+     */
+    class SymbolAutomaton final {
+    public:
+        using State = u8;
+
+        static constexpr State start = 0;
+
+        static_assert(detail::symbolStateCount <= 256);
+
+        constexpr SymbolAutomaton() {
+            for (auto& transitions : m_transitions) {
+                transitions.fill(start);
+            }
+            m_accepted.fill(Lexeme::Empty);
+
+            State nStates = 1;
+            for (auto const& [type, str] : symbolSpellings) {
+                if (!isLexedSymbol(type)) {
+                    continue;
+                }
+                State state = start;
+                for (auto const c : str) {
+                    auto& next = m_transitions[state][static_cast<u8>(c)];
+                    if (next == start) {
+                        next = nStates++;
+                    }
+                    state = next;
+                }
+                m_accepted[state] = type;
+            }
+        }
+
+        [[nodiscard]] constexpr auto next(State const state, c8 const c) const
+            -> State {
+            return m_transitions[state][static_cast<u8>(c)];
+        }
+
+        [[nodiscard]] constexpr auto accepted(State const state) const
+            -> Lexeme {
+            return Lexeme{m_accepted[state]};
+        }
+
+        /**
+         * The longest symbol {text} starts with, with its length. Empty with
+         * a length of 0 if {text} does not start with a symbol.
+         */
+        [[nodiscard]] constexpr auto longestMatch(StrV const text) const
+            -> Pair<Lexeme, szt> {
+            Pair<Lexeme, szt> match{Lexeme{Lexeme::Empty}, 0};
+            State state = start;
+            for (szt i = 0; i < text.size(); ++i) {
+                state = next(state, text[i]);
+                if (state == start) {
+                    break;
+                }
+                if (accepted(state) != Lexeme{Lexeme::Empty}) {
+                    match = {accepted(state), i + 1};
+                }
+            }
+            return match;
+        }
+
+    private:
+        Arr<Arr<State, 256>, detail::symbolStateCount> m_transitions{};
+        Arr<Lexeme::EType, detail::symbolStateCount> m_accepted{};
+    };
+
+    constexpr SymbolAutomaton symbolAutomaton{};
+
     // misc
-    constexpr Lexeme empty{Lexeme::Empty, ""};
-    constexpr Lexeme invalid{Lexeme::Invalid, ""};
+    constexpr Lexeme empty{Lexeme::Empty};
+    constexpr Lexeme invalid{Lexeme::Invalid};
 
     // module
-    constexpr Lexeme module_{Lexeme::Module, "module"};
-    constexpr Lexeme import_{Lexeme::Import, "import"};
+    constexpr Lexeme module_{Lexeme::Module};
+    constexpr Lexeme import_{Lexeme::Import};
 
     // visibility
-    constexpr Lexeme pub{Lexeme::Pub, "pub"};
-    constexpr Lexeme prv{Lexeme::Prv, "prv"};
+    constexpr Lexeme pub{Lexeme::Pub};
+    constexpr Lexeme prv{Lexeme::Prv};
 
     // storage
-    constexpr Lexeme isolated{Lexeme::Isolated, "isolated"};
-    constexpr Lexeme static_{Lexeme::Static, "static"};
+    constexpr Lexeme isolated{Lexeme::Isolated};
+    constexpr Lexeme static_{Lexeme::Static};
 
     // definition
-    constexpr Lexeme let{Lexeme::Let, "let"};
-    constexpr Lexeme fn{Lexeme::Fn, "fn"};
-    constexpr Lexeme trait{Lexeme::Trait, "trait"};
-    constexpr Lexeme type{Lexeme::Type, "type"};
-    constexpr Lexeme enum_{Lexeme::Enum, "enum"};
-    constexpr Lexeme flag{Lexeme::Flag, "flag"};
+    constexpr Lexeme let{Lexeme::Let};
+    constexpr Lexeme fn{Lexeme::Fn};
+    constexpr Lexeme trait{Lexeme::Trait};
+    constexpr Lexeme type{Lexeme::Type};
+    constexpr Lexeme enum_{Lexeme::Enum};
+    constexpr Lexeme flag{Lexeme::Flag};
 
     // control
-    constexpr Lexeme for_{Lexeme::For, "for"};
-    constexpr Lexeme match{Lexeme::Match, "match"};
-    constexpr Lexeme return_{Lexeme::Return, "return"};
-    constexpr Lexeme defer{Lexeme::Defer, "defer"};
-    constexpr Lexeme break_{Lexeme::Break, "break"};
-    constexpr Lexeme continue_{Lexeme::Continue, "continue"};
-    constexpr Lexeme try_{Lexeme::Try, "try"};
+    constexpr Lexeme for_{Lexeme::For};
+    constexpr Lexeme match{Lexeme::Match};
+    constexpr Lexeme return_{Lexeme::Return};
+    constexpr Lexeme defer{Lexeme::Defer};
+    constexpr Lexeme break_{Lexeme::Break};
+    constexpr Lexeme continue_{Lexeme::Continue};
+    constexpr Lexeme try_{Lexeme::Try};
 
     // adverb
-    constexpr Lexeme in{Lexeme::In, "in"};
-    constexpr Lexeme when{Lexeme::When, "when"};
-    constexpr Lexeme impl{Lexeme::Impl, "impl"};
+    constexpr Lexeme in{Lexeme::In};
+    constexpr Lexeme when{Lexeme::When};
+    constexpr Lexeme impl{Lexeme::Impl};
 
     // reserved
-    constexpr Lexeme self{Lexeme::Self, "self"};
-    constexpr Lexeme main_{Lexeme::Main, "main"};
+    constexpr Lexeme self{Lexeme::Self};
+    constexpr Lexeme main_{Lexeme::Main};
 
     // boolean
-    constexpr Lexeme true_{Lexeme::True, "true"};
-    constexpr Lexeme false_{Lexeme::False, "false"};
+    constexpr Lexeme true_{Lexeme::True};
+    constexpr Lexeme false_{Lexeme::False};
 
     // literals
-    constexpr Lexeme identifier{Lexeme::Identifier, ""};
-    constexpr Lexeme fundamentalType{Lexeme::FundamentalType, ""};
-    constexpr Lexeme userDefinedType{Lexeme::UserDefinedType, ""};
-    constexpr Lexeme integer2Literal{Lexeme::Integer2Literal, ""};
-    constexpr Lexeme integer8Literal{Lexeme::Integer8Literal, ""};
-    constexpr Lexeme integer10Literal{Lexeme::Integer10Literal, ""};
-    constexpr Lexeme integer16Literal{Lexeme::Integer16Literal, ""};
-    constexpr Lexeme floatLiteral{Lexeme::FloatLiteral, ""};
-    constexpr Lexeme stringFragment{Lexeme::StringFragment, ""};
-    constexpr Lexeme stringPlaceholder{Lexeme::StringPlaceholder, ""};
+    constexpr Lexeme identifier{Lexeme::Identifier};
+    constexpr Lexeme fundamentalType{Lexeme::FundamentalType};
+    constexpr Lexeme userDefinedType{Lexeme::UserDefinedType};
+    constexpr Lexeme integer2Literal{Lexeme::Integer2Literal};
+    constexpr Lexeme integer8Literal{Lexeme::Integer8Literal};
+    constexpr Lexeme integer10Literal{Lexeme::Integer10Literal};
+    constexpr Lexeme integer16Literal{Lexeme::Integer16Literal};
+    constexpr Lexeme floatLiteral{Lexeme::FloatLiteral};
+    constexpr Lexeme stringFragment{Lexeme::StringFragment};
+    constexpr Lexeme placeholderBegin{Lexeme::PlaceholderBegin};
+    constexpr Lexeme placeholderEnd{Lexeme::PlaceholderEnd};
 
     // one-character symbols
-    constexpr Lexeme leftParen{Lexeme::LeftParen, "("};
-    constexpr Lexeme rightParen{Lexeme::RightParen, ")"};
-    constexpr Lexeme leftBracket{Lexeme::LeftBracket, "["};
-    constexpr Lexeme rightBracket{Lexeme::RightBracket, "]"};
-    constexpr Lexeme leftBrace{Lexeme::LeftBrace, "{"};
-    constexpr Lexeme rightBrace{Lexeme::RightBrace, "}"};
-    constexpr Lexeme hash{Lexeme::Hash, "#"};
-    constexpr Lexeme dot{Lexeme::Dot, "."};
-    constexpr Lexeme comma{Lexeme::Comma, ","};
-    constexpr Lexeme colon{Lexeme::Colon, ":"};
-    constexpr Lexeme semicolon{Lexeme::Semicolon, ";"};
-    constexpr Lexeme star{Lexeme::Star, "*"};
-    constexpr Lexeme ampersand{Lexeme::Ampersand, "&"};
-    constexpr Lexeme bar{Lexeme::Bar, "|"};
-    constexpr Lexeme plus{Lexeme::Plus, "+"};
-    constexpr Lexeme minus{Lexeme::Minus, "-"};
-    constexpr Lexeme fwdSlash{Lexeme::FwdSlash, "/"};
-    constexpr Lexeme percent{Lexeme::Percent, "%"};
-    constexpr Lexeme exclaim{Lexeme::Exclaim, "!"};
-    constexpr Lexeme equal{Lexeme::Equal, "="};
-    constexpr Lexeme greater{Lexeme::Greater, ">"};
-    constexpr Lexeme less{Lexeme::Less, "<"};
-    constexpr Lexeme qMark{Lexeme::QMark, "?"};
-    constexpr Lexeme hat{Lexeme::Hat, "^"};
-    constexpr Lexeme tilde{Lexeme::Tilde, "~"};
-    constexpr Lexeme dollar{Lexeme::Dollar, "$"};
-    constexpr Lexeme at{Lexeme::At, "@"};
-    constexpr Lexeme anonymous{Lexeme::Anonymous, "_"};
+    constexpr Lexeme leftParen{Lexeme::LeftParen};
+    constexpr Lexeme rightParen{Lexeme::RightParen};
+    constexpr Lexeme leftBracket{Lexeme::LeftBracket};
+    constexpr Lexeme rightBracket{Lexeme::RightBracket};
+    constexpr Lexeme leftBrace{Lexeme::LeftBrace};
+    constexpr Lexeme rightBrace{Lexeme::RightBrace};
+    constexpr Lexeme hash{Lexeme::Hash};
+    constexpr Lexeme dot{Lexeme::Dot};
+    constexpr Lexeme comma{Lexeme::Comma};
+    constexpr Lexeme colon{Lexeme::Colon};
+    constexpr Lexeme semicolon{Lexeme::Semicolon};
+    constexpr Lexeme star{Lexeme::Star};
+    constexpr Lexeme ampersand{Lexeme::Ampersand};
+    constexpr Lexeme bar{Lexeme::Bar};
+    constexpr Lexeme plus{Lexeme::Plus};
+    constexpr Lexeme minus{Lexeme::Minus};
+    constexpr Lexeme fwdSlash{Lexeme::FwdSlash};
+    constexpr Lexeme percent{Lexeme::Percent};
+    constexpr Lexeme exclaim{Lexeme::Exclaim};
+    constexpr Lexeme equal{Lexeme::Equal};
+    constexpr Lexeme greater{Lexeme::Greater};
+    constexpr Lexeme less{Lexeme::Less};
+    constexpr Lexeme qMark{Lexeme::QMark};
+    constexpr Lexeme hat{Lexeme::Hat};
+    constexpr Lexeme tilde{Lexeme::Tilde};
+    constexpr Lexeme dollar{Lexeme::Dollar};
+    constexpr Lexeme at{Lexeme::At};
+    constexpr Lexeme anonymous{Lexeme::Anonymous};
 
     // two-character symbols
-    constexpr Lexeme star2{Lexeme::Star2, "**"};
-    constexpr Lexeme ampersand2{Lexeme::Ampersand2, "&&"};
-    constexpr Lexeme bar2{Lexeme::Bar2, "||"};
-    constexpr Lexeme plus2{Lexeme::Plus2, "++"};
-    constexpr Lexeme minus2{Lexeme::Minus2, "--"};
-    constexpr Lexeme exclaim2{Lexeme::Exclaim2, "!!"};
-    constexpr Lexeme equal2{Lexeme::Equal2, "=="};
-    constexpr Lexeme greater2{Lexeme::Greater2, ">>"};
-    constexpr Lexeme less2{Lexeme::Less2, "<<"};
-    constexpr Lexeme qMark2{Lexeme::QMark2, "??"};
-    constexpr Lexeme exclaimEqual{Lexeme::ExclaimEqual, "!="};
-    constexpr Lexeme starEqual{Lexeme::StarEqual, "*="};
-    constexpr Lexeme ampersandEqual{Lexeme::AmpersandEqual, "&="};
-    constexpr Lexeme barEqual{Lexeme::BarEqual, "|="};
-    constexpr Lexeme fwdSlashEqual{Lexeme::FwdSlashEqual, "/="};
-    constexpr Lexeme percentEqual{Lexeme::PercentEqual, "%="};
-    constexpr Lexeme greaterEqual{Lexeme::GreaterEqual, ">="};
-    constexpr Lexeme lessEqual{Lexeme::LessEqual, "<="};
-    constexpr Lexeme plusEqual{Lexeme::PlusEqual, "+="};
-    constexpr Lexeme minusEqual{Lexeme::MinusEqual, "-="};
-    constexpr Lexeme colonEqual{Lexeme::ColonEqual, ":="};
-    constexpr Lexeme barGreater{Lexeme::BarGreater, "|>"};
-    constexpr Lexeme minusGreater{Lexeme::MinusGreater, "->"};
-    constexpr Lexeme lessMinus{Lexeme::LessMinus, "<-"};
-    constexpr Lexeme dot2{Lexeme::Dot2, ".."};
-    constexpr Lexeme hatEqual{Lexeme::HatEqual, "^="};
-    constexpr Lexeme equalGreater{Lexeme::EqualGreater, "=>"};
+    constexpr Lexeme star2{Lexeme::Star2};
+    constexpr Lexeme ampersand2{Lexeme::Ampersand2};
+    constexpr Lexeme bar2{Lexeme::Bar2};
+    constexpr Lexeme plus2{Lexeme::Plus2};
+    constexpr Lexeme minus2{Lexeme::Minus2};
+    constexpr Lexeme exclaim2{Lexeme::Exclaim2};
+    constexpr Lexeme equal2{Lexeme::Equal2};
+    constexpr Lexeme greater2{Lexeme::Greater2};
+    constexpr Lexeme less2{Lexeme::Less2};
+    constexpr Lexeme qMark2{Lexeme::QMark2};
+    constexpr Lexeme exclaimEqual{Lexeme::ExclaimEqual};
+    constexpr Lexeme starEqual{Lexeme::StarEqual};
+    constexpr Lexeme ampersandEqual{Lexeme::AmpersandEqual};
+    constexpr Lexeme barEqual{Lexeme::BarEqual};
+    constexpr Lexeme fwdSlashEqual{Lexeme::FwdSlashEqual};
+    constexpr Lexeme percentEqual{Lexeme::PercentEqual};
+    constexpr Lexeme greaterEqual{Lexeme::GreaterEqual};
+    constexpr Lexeme lessEqual{Lexeme::LessEqual};
+    constexpr Lexeme plusEqual{Lexeme::PlusEqual};
+    constexpr Lexeme minusEqual{Lexeme::MinusEqual};
+    constexpr Lexeme colonEqual{Lexeme::ColonEqual};
+    constexpr Lexeme barGreater{Lexeme::BarGreater};
+    constexpr Lexeme minusGreater{Lexeme::MinusGreater};
+    constexpr Lexeme lessMinus{Lexeme::LessMinus};
+    constexpr Lexeme dot2{Lexeme::Dot2};
+    constexpr Lexeme hatEqual{Lexeme::HatEqual};
+    constexpr Lexeme equalGreater{Lexeme::EqualGreater};
 
     // three-character symbols
-    constexpr Lexeme dot3{Lexeme::Dot3, "..."};
-    constexpr Lexeme greater2Equal{Lexeme::Greater2Equal, ">>="};
-    constexpr Lexeme less2Equal{Lexeme::Less2Equal, "<<="};
-    constexpr Lexeme star2Equal{Lexeme::Star2Equal, "**="};
-
-    extern const HashMap<StrV, Lexeme> nonTypeKeywordTable;
-    extern const HashMap<StrV, Lexeme> symbolTable;
-    extern const HashSet<StrV> fundamentalTypes;
-    using OpGraph3 = HashMap<c8, HashMap<c8, HashSet<c8>>>;
-    extern const OpGraph3 opGraph;
+    constexpr Lexeme dot3{Lexeme::Dot3};
+    constexpr Lexeme greater2Equal{Lexeme::Greater2Equal};
+    constexpr Lexeme less2Equal{Lexeme::Less2Equal};
+    constexpr Lexeme star2Equal{Lexeme::Star2Equal};
 }
 
 template <>
 struct std::hash<tlc::lexeme::Lexeme> {
     constexpr auto operator()(
-        tlc::lexeme::Lexeme const& lexeme
+        tlc::lexeme::Lexeme const lexeme
     ) const noexcept -> tlc::szt {
-        return hash<tlc::szt>()(static_cast<tlc::szt>(lexeme.type()));
+        return static_cast<tlc::szt>(lexeme.type());
     }
 };
 
@@ -4,12 +4,24 @@
 #include "core/core.hpp"
 #include "lexeme.hpp"
 
+#include <variant>
+
 namespace tlc::token {
+    // value of a numeric literal, empty when it does not fit
+    using NumericValue = std::variant<std::monostate, i64, f64>;
+
+    class TokenView;
+
     class Token final {
     public:
-        constexpr Token(lexeme::Lexeme type, StrV const str,
-                        Location const location)
-            : m_lexeme{std::move(type)}, m_str{str}, m_location{location} {}
+        constexpr Token(lexeme::Lexeme const type, StrV const str,
+                        SourceLocation const location, Symbol const symbol = {},
+                        NumericValue const value = {})
+            : m_lexeme{type}, m_str{str}, m_location{location},
+              m_symbol{symbol}, m_value{value} {}
+
+        // copies the spelling out of the storage the view refers to
+        explicit constexpr Token(TokenView view);
 
         template <typename S>
         [[nodiscard]] auto lexeme(this S&& self) noexcept -> auto&& {
@@ -26,19 +38,94 @@ namespace tlc::token {
             return std::forward<S>(self).m_location;
         }
 
-        [[nodiscard]] auto line() const noexcept -> szt {
-            return m_location.line;
+        // interned spelling of identifiers and type names
+        [[nodiscard]] auto symbol() const noexcept -> Symbol {
+            return m_symbol;
+        }
+
+        // computed by the lexer for integer and float literals
+        [[nodiscard]] auto value() const noexcept -> NumericValue const& {
+            return m_value;
+        }
+
+        [[nodiscard]] auto line() const -> szt {
+            return SourceManager::instance().location(m_location).line;
         }
 
-        [[nodiscard]] auto column() const noexcept -> szt {
-            return m_location.column;
+        [[nodiscard]] auto column() const -> szt {
+            return SourceManager::instance().location(m_location).column;
         }
 
     private:
         lexeme::Lexeme m_lexeme;
         Str m_str;
-        Location m_location;
+        SourceLocation m_location;
+        Symbol m_symbol;
+        NumericValue m_value;
+    };
+
+    /**
+     * Token that does not own its spelling, which stays in the buffer or
+     * stream it was taken from. Taking a view never allocates, but str() is
+     * only valid for as long as that storage holds the token.
+     */
+    class TokenView final {
+    public:
+        constexpr TokenView(lexeme::Lexeme const type, StrV const str,
+                            SourceLocation const location,
+                            Symbol const symbol = {},
+                            NumericValue const value = {}) noexcept
+            : m_lexeme{type}, m_str{str}, m_location{location},
+              m_symbol{symbol}, m_value{value} {}
+
+        // NOLINTNEXTLINE(*-explicit-constructor)
+        constexpr TokenView(Token const& token) noexcept
+            : TokenView{
+                token.lexeme(), token.str(), token.location(), token.symbol(),
+                token.value()
+            } {}
+
+        [[nodiscard]] constexpr auto lexeme() const noexcept -> lexeme::Lexeme {
+            return m_lexeme;
+        }
+
+        [[nodiscard]] constexpr auto str() const noexcept -> StrV {
+            return m_str;
+        }
+
+        [[nodiscard]] constexpr auto location() const noexcept -> SourceLocation {
+            return m_location;
+        }
+
+        [[nodiscard]] constexpr auto symbol() const noexcept -> Symbol {
+            return m_symbol;
+        }
+
+        [[nodiscard]] constexpr auto value() const noexcept -> NumericValue const& {
+            return m_value;
+        }
+
+        [[nodiscard]] auto line() const -> szt {
+            return SourceManager::instance().location(m_location).line;
+        }
+
+        [[nodiscard]] auto column() const -> szt {
+            return SourceManager::instance().location(m_location).column;
+        }
+
+    private:
+        lexeme::Lexeme m_lexeme;
+        StrV m_str;
+        SourceLocation m_location;
+        Symbol m_symbol;
+        NumericValue m_value;
     };
+
+    constexpr Token::Token(TokenView const view)
+        : Token{
+            view.lexeme(), view.str(), view.location(), view.symbol(),
+            view.value()
+        } {}
 }
 
 #endif // TLC_TOKEN_IMPL_HPP
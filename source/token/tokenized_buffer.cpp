@@ -1 +1,152 @@
 #include "tokenized_buffer.hpp"
+
+#include <bit>
+
+namespace tlc::token {
+    namespace {
+        // source range of a string fragment without the opening quote and
+        // the closing quote or placeholder brace that delimit it
+        auto fragmentBody(StrV range) -> StrV {
+            if (range.starts_with('"')) {
+                range.remove_prefix(1);
+            }
+            if (range.ends_with('"') || range.ends_with('{')) {
+                range.remove_suffix(1);
+            }
+            return range;
+        }
+    }
+
+    auto TokenizedBuffer::push(
+        lexeme::Lexeme const lexeme, szt const offset, szt const length,
+        StrV const spelling
+    ) -> TokenIndex {
+        auto const index = static_cast<TokenIndex>(size());
+        m_kinds.push_back(lexeme.type());
+        m_offsets.push_back(static_cast<u32>(offset));
+        m_lengths.push_back(static_cast<u32>(length));
+
+        if (isName(lexeme.type())) {
+            m_payloads.push_back(static_cast<u32>(m_symbols.size()));
+            m_symbols.push_back(Interner::instance().intern(spelling));
+        }
+        else if (isString(lexeme.type()) &&
+            (offset + length > source().size() ||
+                fragmentBody(source().substr(offset, length)) != spelling)) {
+            m_payloads.push_back(static_cast<u32>(m_spellings.size()));
+            m_spellings.push_back({
+                static_cast<u32>(m_spellingData.size()),
+                static_cast<u32>(spelling.size())
+            });
+            m_spellingData += spelling;
+        }
+        else {
+            m_payloads.push_back(noPayload);
+        }
+
+        return index;
+    }
+
+    auto TokenizedBuffer::pushNumber(
+        lexeme::Lexeme const lexeme, szt const offset, szt const length,
+        NumericValue const value
+    ) -> TokenIndex {
+        auto const index = static_cast<TokenIndex>(size());
+        m_kinds.push_back(lexeme.type());
+        m_offsets.push_back(static_cast<u32>(offset));
+        m_lengths.push_back(static_cast<u32>(length));
+
+        if (auto const* integer = std::get_if<i64>(&value)) {
+            m_payloads.push_back(static_cast<u32>(m_numbers.size()));
+            m_numbers.push_back(std::bit_cast<u64>(*integer));
+        }
+        else if (auto const* floating = std::get_if<f64>(&value)) {
+            m_payloads.push_back(static_cast<u32>(m_numbers.size()));
+            m_numbers.push_back(std::bit_cast<u64>(*floating));
+        }
+        else {
+            m_payloads.push_back(noPayload);
+        }
+
+        return index;
+    }
+
+    auto TokenizedBuffer::reserve(szt const size) -> void {
+        m_kinds.reserve(size);
+        m_offsets.reserve(size);
+        m_lengths.reserve(size);
+        m_payloads.reserve(size);
+    }
+
+    auto TokenizedBuffer::append(TokenizedBuffer const& other) -> void {
+        auto const symbolBase = static_cast<u32>(m_symbols.size());
+        auto const spellingBase = static_cast<u32>(m_spellings.size());
+        auto const numberBase = static_cast<u32>(m_numbers.size());
+        auto const spellingDataBase = static_cast<u32>(m_spellingData.size());
+
+        m_kinds.insert(m_kinds.end(), other.m_kinds.begin(), other.m_kinds.end());
+        m_offsets.insert(m_offsets.end(), other.m_offsets.begin(), other.m_offsets.end());
+        m_lengths.insert(m_lengths.end(), other.m_lengths.begin(), other.m_lengths.end());
+
+        m_payloads.reserve(m_payloads.size() + other.m_payloads.size());
+        for (szt i = 0; i < other.m_payloads.size(); ++i) {
+            auto const payload = other.m_payloads[i];
+            m_payloads.push_back(
+                payload == noPayload ? noPayload :
+                isName(other.m_kinds[i]) ? symbolBase + payload :
+                isNumber(other.m_kinds[i]) ? numberBase + payload :
+                spellingBase + payload
+            );
+        }
+
+        m_symbols.insert(m_symbols.end(), other.m_symbols.begin(), other.m_symbols.end());
+        m_numbers.insert(m_numbers.end(), other.m_numbers.begin(), other.m_numbers.end());
+        for (auto const [offset, length] : other.m_spellings) {
+            m_spellings.push_back({spellingDataBase + offset, length});
+        }
+        m_spellingData += other.m_spellingData;
+    }
+
+    auto TokenizedBuffer::clear() noexcept -> void {
+        m_kinds.clear();
+        m_offsets.clear();
+        m_lengths.clear();
+        m_payloads.clear();
+        m_symbols.clear();
+        m_numbers.clear();
+        m_spellings.clear();
+        m_spellingData.clear();
+    }
+
+    auto TokenizedBuffer::str(TokenIndex const index) const -> StrV {
+        if (isString(m_kinds[index]) && m_payloads[index] != noPayload) {
+            auto const [offset, length] = m_spellings[m_payloads[index]];
+            return StrV{m_spellingData}.substr(offset, length);
+        }
+
+        auto const spelling = source().substr(m_offsets[index], m_lengths[index]);
+        return isString(m_kinds[index]) ? fragmentBody(spelling) : spelling;
+    }
+
+    auto TokenizedBuffer::value(TokenIndex const index) const -> NumericValue {
+        if (!isNumber(m_kinds[index]) || m_payloads[index] == noPayload) {
+            return {};
+        }
+
+        auto const bits = m_numbers[m_payloads[index]];
+        if (m_kinds[index] == lexeme::Lexeme::FloatLiteral) {
+            return std::bit_cast<f64>(bits);
+        }
+        return std::bit_cast<i64>(bits);
+    }
+
+    auto TokenizedBuffer::memoryUsage() const noexcept -> szt {
+        return m_kinds.capacity() * sizeof(lexeme::Lexeme::EType) +
+            (m_offsets.capacity() + m_lengths.capacity() +
+                m_payloads.capacity()) * sizeof(u32) +
+            m_symbols.capacity() * sizeof(Symbol) +
+            m_numbers.capacity() * sizeof(u64) +
+            m_spellings.capacity() * sizeof(Spelling) +
+            m_spellingData.capacity();
+    }
+}
@@ -5,13 +5,154 @@
 #include "token_impl.hpp"
 
 namespace tlc::token {
-    using TokenizedBuffer = Vec<Token>;
+    // handle of a token, only meaningful for the buffer it came from
+    using TokenIndex = u32;
 
-    // todo:
-    // class TokenizedBuffer {
-    // public:
-    // private:
-    // };
+    /**
+     * Tokens of a source file stored as parallel arrays. Tokens are referred
+     * to by their TokenIndex and spelled by a view of the source they were
+     * lexed from, except for string fragments whose decoded contents are kept
+     * out of line. Identifiers and type names are interned as they are
+     * pushed.
+     */
+    class TokenizedBuffer final {
+    public:
+        TokenizedBuffer() = default;
+
+        explicit TokenizedBuffer(FileID const file)
+            : m_file{file}, m_source{SourceManager::instance().buffer(file)} {}
+
+        /**
+         * Appends a token lexed from source[offset, offset + length). The
+         * {spelling} of a string fragment is stored when it differs from that
+         * range stripped of its quotes and placeholder brace, any other token
+         * must be spelled as is.
+         */
+        auto push(
+            lexeme::Lexeme lexeme, szt offset, szt length, StrV spelling
+        ) -> TokenIndex;
+
+        /**
+         * Appends a numeric literal lexed from source[offset, offset + length)
+         * along with its {value}. Numeric literals appended by push() have no
+         * value.
+         */
+        auto pushNumber(
+            lexeme::Lexeme lexeme, szt offset, szt length, NumericValue value
+        ) -> TokenIndex;
+
+        auto reserve(szt size) -> void;
+
+        /**
+         * Appends the tokens of {other}, which must have been lexed from the
+         * same file after the last token of this buffer.
+         */
+        auto append(TokenizedBuffer const& other) -> void;
+
+        // drops every token but keeps the memory for reuse
+        auto clear() noexcept -> void;
+
+        [[nodiscard]] auto size() const noexcept -> szt {
+            return m_kinds.size();
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> b8 {
+            return m_kinds.empty();
+        }
+
+        [[nodiscard]] auto kind(TokenIndex const index) const -> lexeme::Lexeme::EType {
+            return m_kinds[index];
+        }
+
+        [[nodiscard]] auto lexeme(TokenIndex const index) const -> lexeme::Lexeme {
+            return lexeme::Lexeme{m_kinds[index]};
+        }
+
+        [[nodiscard]] auto str(TokenIndex index) const -> StrV;
+
+        // the empty symbol for tokens that are not names
+        [[nodiscard]] auto symbol(TokenIndex const index) const -> Symbol {
+            return isName(m_kinds[index])
+                ? m_symbols[m_payloads[index]]
+                : Symbol{};
+        }
+
+        [[nodiscard]] auto value(TokenIndex index) const -> NumericValue;
+
+        [[nodiscard]] auto offset(TokenIndex const index) const -> szt {
+            return m_offsets[index];
+        }
+
+        [[nodiscard]] auto length(TokenIndex const index) const -> szt {
+            return m_lengths[index];
+        }
+
+        [[nodiscard]] auto location(TokenIndex const index) const
+            -> SourceLocation {
+            return {m_offsets[index], m_file};
+        }
+
+        [[nodiscard]] auto file() const noexcept -> FileID {
+            return m_file;
+        }
+
+        [[nodiscard]] auto operator[](TokenIndex const index) const -> Token {
+            return Token{view(index)};
+        }
+
+        // the token at {index} without copying its spelling
+        [[nodiscard]] auto view(TokenIndex const index) const -> TokenView {
+            return {
+                lexeme(index), str(index), location(index), symbol(index),
+                value(index)
+            };
+        }
+
+        // heap memory owned by the buffer, the source excluded
+        [[nodiscard]] auto memoryUsage() const noexcept -> szt;
+
+    private:
+        [[nodiscard]] auto source() const noexcept -> StrV {
+            return m_source ? m_source->view() : StrV{};
+        }
+
+        static constexpr auto isString(lexeme::Lexeme::EType const kind) -> b8 {
+            return kind == lexeme::Lexeme::StringFragment;
+        }
+
+        static constexpr auto isName(lexeme::Lexeme::EType const kind) -> b8 {
+            return kind == lexeme::Lexeme::Identifier ||
+                kind == lexeme::Lexeme::Anonymous ||
+                kind == lexeme::Lexeme::UserDefinedType ||
+                kind == lexeme::Lexeme::FundamentalType;
+        }
+
+        static constexpr auto isNumber(lexeme::Lexeme::EType const kind) -> b8 {
+            return kind >= lexeme::Lexeme::Integer2Literal &&
+                kind <= lexeme::Lexeme::FloatLiteral;
+        }
+
+    private:
+        struct Spelling {
+            u32 offset, length;
+        };
+
+        static constexpr u32 noPayload = ~u32{};
+
+        FileID m_file = SourceManager::noFile;
+        SPtr<SourceBuffer const> m_source;
+        Vec<lexeme::Lexeme::EType> m_kinds{};
+        Vec<u32> m_offsets{}, m_lengths{};
+        // per token index into m_symbols for names, into m_spellings for
+        // strings spelled out of line or into m_numbers for numeric literals
+        // with a value
+        Vec<u32> m_payloads{};
+        Vec<Symbol> m_symbols{};
+        // bits of an i64 or an f64 depending on the kind of the literal
+        Vec<u64> m_numbers{};
+        Vec<Spelling> m_spellings{};
+        Str m_spellingData{};
+    };
 }
 
 #endif // TLC_TOKEN_TOKENIZED_BUFFER_HPP
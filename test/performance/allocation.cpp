@@ -0,0 +1,63 @@
+#include "allocation.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <sys/resource.h>
+
+namespace {
+    std::atomic<tlc::szt> allocationCount{0};
+    std::atomic<tlc::szt> allocatedBytes{0};
+
+    auto allocate(tlc::szt const size) -> void* {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        if (auto* const ptr = std::malloc(size == 0 ? 1 : size)) {
+            return ptr;
+        }
+        throw std::bad_alloc{};
+    }
+}
+
+namespace tlc::test {
+    auto allocationStats() noexcept -> AllocationStats {
+        return {
+            allocationCount.load(std::memory_order_relaxed),
+            allocatedBytes.load(std::memory_order_relaxed),
+        };
+    }
+
+    auto peakResidentSetSize() noexcept -> szt {
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+        // kilobytes on Linux
+        return static_cast<szt>(usage.ru_maxrss) * 1024;
+    }
+}
+
+auto operator new(std::size_t const size) -> void* {
+    return allocate(size);
+}
+
+auto operator new[](std::size_t const size) -> void* {
+    return allocate(size);
+}
+
+auto operator delete(void* const ptr) noexcept -> void {
+    std::free(ptr);
+}
+
+auto operator delete[](void* const ptr) noexcept -> void {
+    std::free(ptr);
+}
+
+auto operator delete(void* const ptr, std::size_t) noexcept -> void {
+    std::free(ptr);
+}
+
+auto operator delete[](void* const ptr, std::size_t) noexcept -> void {
+    std::free(ptr);
+}
@@ -0,0 +1,29 @@
+#ifndef TLC_TEST_PERFORMANCE_ALLOCATION_HPP
+#define TLC_TEST_PERFORMANCE_ALLOCATION_HPP
+
+#include "core/core.hpp"
+
+namespace tlc::test {
+    struct AllocationStats {
+        szt count{}, bytes{};
+    };
+
+    // allocations made through the global operator new so far
+    auto allocationStats() noexcept -> AllocationStats;
+
+    // high-water mark of the resident set of the process, in bytes
+    auto peakResidentSetSize() noexcept -> szt;
+
+    template <typename F>
+    auto countAllocations(F&& f) -> Pair<std::invoke_result_t<F>, AllocationStats> {
+        auto const before = allocationStats();
+        auto result = std::forward<F>(f)();
+        auto const after = allocationStats();
+        return {
+            std::move(result),
+            {after.count - before.count, after.bytes - before.bytes}
+        };
+    }
+}
+
+#endif // TLC_TEST_PERFORMANCE_ALLOCATION_HPP
@@ -0,0 +1,67 @@
+#include "baseline.hpp"
+
+#include <cstdlib>
+#include <format>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+namespace tlc::test {
+    auto Baseline::fromEnvironment() -> Baseline {
+        auto const* const path = std::getenv("TLC_PERF_BASELINE");
+        auto const* const threshold = std::getenv("TLC_PERF_THRESHOLD");
+        auto const* const update = std::getenv("TLC_PERF_UPDATE");
+        return {
+            path ? path : TLC_TEST_PERFORMANCE_BASELINE,
+            threshold ? std::stod(threshold) : defaultThreshold,
+            update && StrV{update} != "0",
+        };
+    }
+
+    Baseline::Baseline(
+        std::filesystem::path path, f64 const threshold, b8 const update
+    ) : m_path{std::move(path)}, m_threshold{threshold}, m_update{update} {}
+
+    auto Baseline::check(Span<Metric const> const metrics) -> Vec<Str> {
+        auto stored = nlohmann::json::object();
+        if (std::ifstream file{m_path}; file) {
+            stored = nlohmann::json::parse(file);
+        }
+        else if (!m_update) {
+            return {std::format(
+                "no baseline at {}, record one with TLC_PERF_UPDATE=1",
+                m_path.string()
+            )};
+        }
+
+        Vec<Str> regressions;
+        for (auto const& [name, value, goal] : metrics) {
+            if (m_update) {
+                stored[name] = value;
+                continue;
+            }
+            if (!stored.contains(name)) {
+                regressions.push_back(
+                    std::format("{}: {:.2f}, no baseline", name, value)
+                );
+                continue;
+            }
+
+            auto const expected = stored[name].get<f64>();
+            auto const change = goal == EMetricGoal::Higher
+                ? expected - value
+                : value - expected;
+            if (change > m_threshold * expected) {
+                regressions.push_back(std::format(
+                    "{}: {:.2f}, baseline {:.2f} ({:+.1f}%)",
+                    name, value, expected, (value / expected - 1) * 100
+                ));
+            }
+        }
+
+        if (m_update) {
+            std::ofstream{m_path} << stored.dump(4) << '\n';
+        }
+        return regressions;
+    }
+}
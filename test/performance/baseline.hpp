@@ -0,0 +1,54 @@
+#ifndef TLC_TEST_PERFORMANCE_BASELINE_HPP
+#define TLC_TEST_PERFORMANCE_BASELINE_HPP
+
+#include "core/core.hpp"
+
+#include <filesystem>
+
+namespace tlc::test {
+    enum class EMetricGoal {
+        Higher,
+        Lower,
+    };
+
+    struct Metric {
+        Str name;
+        f64 value;
+        EMetricGoal goal;
+    };
+
+    /**
+     * Metrics of a reference run, stored as a JSON object from names to
+     * values. A metric regresses when it is worse than its stored value by
+     * more than {threshold} times that value. A missing file or metric fails
+     * the check; the file is only written when updating.
+     */
+    class Baseline final {
+    public:
+        static constexpr f64 defaultThreshold = 0.1;
+
+        // reads TLC_PERF_BASELINE, TLC_PERF_THRESHOLD and TLC_PERF_UPDATE
+        static auto fromEnvironment() -> Baseline;
+
+        Baseline(std::filesystem::path path, f64 threshold, b8 update);
+
+        // descriptions of the regressed metrics and of those with no baseline
+        auto check(Span<Metric const> metrics) -> Vec<Str>;
+
+        [[nodiscard]] auto path() const noexcept
+            -> std::filesystem::path const& {
+            return m_path;
+        }
+
+        [[nodiscard]] auto threshold() const noexcept -> f64 {
+            return m_threshold;
+        }
+
+    private:
+        std::filesystem::path m_path;
+        f64 m_threshold;
+        b8 m_update;
+    };
+}
+
+#endif // TLC_TEST_PERFORMANCE_BASELINE_HPP
@@ -0,0 +1,264 @@
+#ifndef TLC_TEST_PERFORMANCE_CORPUS_HPP
+#define TLC_TEST_PERFORMANCE_CORPUS_HPP
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/core.hpp"
+#include "lex/lex.hpp"
+#include "parse/parse.hpp"
+
+#include <format>
+#include <random>
+
+namespace tlc::test {
+    /**
+     * Deterministic Toy source of at least {size} bytes, made of statements
+     * mixing identifiers, keywords, numbers, strings and symbols.
+     */
+    inline auto generateCorpus(szt const size) -> Str {
+        static constexpr auto statements = Arr<StrV, 6>{
+            "let value{0}: Int = 0x{0:x} + count{1} * {1};\n",
+            "x{0} = foo.bar{1}(y{0}, 3.25, \"text {{z{1}}} and more\");\n",
+            "for (i{0}: Int, v{1}: Float) in range{0} {{ sum := sum + v{1}; }}\n",
+            "x{0} == y{1} => return (x{0}, y{1}, 0b1010);\n",
+            "defer release{0}(handle{1});\n",
+            "\tpoint{0} = Point{{x: {0}, y: {1}, visible: true}};\n",
+        };
+
+        Str corpus;
+        corpus.reserve(size + 128);
+        for (szt i = 0; corpus.size() < size; ++i) {
+            auto const other = (i * 7) % 1000;
+            corpus += std::vformat(
+                statements[i % statements.size()],
+                std::make_format_args(i, other)
+            );
+        }
+        return corpus;
+    }
+
+    /**
+     * Deterministic Toy source of at least {size} bytes where nine in ten
+     * words are identifiers or type names and the rest are keywords and
+     * fundamental types.
+     */
+    inline auto generateIdentifierCorpus(szt const size) -> Str {
+        static constexpr auto reserved = Arr<StrV, 8>{
+            "let", "fn", "return", "match", "Int", "String", "true", "for",
+        };
+        static constexpr auto names = Arr<StrV, 6>{
+            "value", "count", "Point", "index", "buffer", "Handle",
+        };
+
+        Str corpus;
+        corpus.reserve(size + 64);
+        for (szt i = 0; corpus.size() < size; ++i) {
+            if (i % 10 == 9) {
+                corpus += reserved[(i / 10) % reserved.size()];
+            }
+            else {
+                corpus += names[i % names.size()];
+                corpus += std::to_string((i * 7) % 1000);
+            }
+            corpus += i % 8 == 7 ? '\n' : ' ';
+        }
+        return corpus;
+    }
+
+    struct CorpusOptions {
+        szt functions = 1000;
+        szt statementsPerFunction = 8;
+        // nesting of operators, calls and aggregates in every expression
+        szt expressionDepth = 4;
+        // chance of an expression leaf being an interpolated string
+        f64 interpolationDensity = 0.1;
+        // imports per function
+        f64 importDensity = 0.05;
+        u64 seed = 0;
+    };
+
+    /**
+     * Deterministic Toy module of {options.functions} function definitions
+     * that parses without errors. Equal options generate equal modules.
+     */
+    class ModuleGenerator final {
+        static constexpr auto binaryOps = Arr<StrV, 8>{
+            "+", "-", "*", "/", "<", "==", "&&", "|>",
+        };
+
+    public:
+        explicit ModuleGenerator(CorpusOptions const& options)
+            : m_options{options}, m_random{options.seed} {}
+
+        auto operator()() -> Str {
+            m_corpus = "module bench.corpus;\n\n";
+            auto const imports = static_cast<szt>(
+                static_cast<f64>(m_options.functions) * m_options.importDensity
+            );
+            for (szt i = 0; i < imports; ++i) {
+                m_corpus += i % 2 == 0
+                    ? std::format("import lib{}.module{};\n", i % 7, i)
+                    : std::format("import alias{} = lib{}.module{};\n", i, i % 7, i);
+            }
+
+            for (szt i = 0; i < m_options.functions; ++i) {
+                function(i);
+            }
+            return std::move(m_corpus);
+        }
+
+    private:
+        // distributions are implementation-defined, the engine is not
+        auto chance(f64 const probability) -> b8 {
+            static constexpr u64 resolution = 1 << 20;
+            return static_cast<f64>(m_random() % resolution) <
+                probability * static_cast<f64>(resolution);
+        }
+
+        auto pick(szt const count) -> szt {
+            return static_cast<szt>(m_random() % count);
+        }
+
+        auto function(szt const index) -> void {
+            m_corpus += std::format(
+                "\n{}fn f{}::(a: Int, b: Float, s: String) -> (r: Int) {{\n",
+                index % 3 == 0 ? "pub " : "", index
+            );
+            for (szt i = 0; i < m_options.statementsPerFunction; ++i) {
+                m_corpus += "    ";
+                statement(i);
+                m_corpus += '\n';
+            }
+            m_corpus += "    return ";
+            expression(m_options.expressionDepth, true);
+            m_corpus += ";\n}\n";
+        }
+
+        auto statement(szt const index) -> void {
+            switch (pick(4)) {
+            case 0:
+                m_corpus += std::format("for e{} in x{} {{ v{} = ", index, index, index);
+                expression(m_options.expressionDepth, true);
+                m_corpus += "; }";
+                return;
+            case 1:
+                m_corpus += "defer io.println(";
+                expression(m_options.expressionDepth, true);
+                m_corpus += ");";
+                return;
+            case 2:
+                m_corpus += "log.trace(";
+                expression(m_options.expressionDepth, true);
+                m_corpus += ", b);";
+                return;
+            default:
+                m_corpus += std::format("x{} = ", index);
+                expression(m_options.expressionDepth, true);
+                m_corpus += ';';
+            }
+        }
+
+        // placeholders cannot nest, so strings are only allowed outside them
+        auto expression(szt const depth, b8 const allowStrings) -> void {
+            if (depth == 0) {
+                leaf(allowStrings);
+                return;
+            }
+
+            switch (pick(6)) {
+            case 0:
+                m_corpus += "math.max(";
+                expression(depth - 1, allowStrings);
+                m_corpus += ", ";
+                expression(depth - 1, allowStrings);
+                m_corpus += ')';
+                return;
+            case 1:
+                m_corpus += "geo.Point{x: ";
+                expression(depth - 1, allowStrings);
+                m_corpus += ", y: ";
+                expression(depth - 1, allowStrings);
+                m_corpus += '}';
+                return;
+            case 2:
+                m_corpus += '[';
+                expression(depth - 1, allowStrings);
+                m_corpus += ", ";
+                leaf(allowStrings);
+                m_corpus += ']';
+                return;
+            default:
+                m_corpus += '(';
+                expression(depth - 1, allowStrings);
+                m_corpus += std::format(" {} ", binaryOps[pick(binaryOps.size())]);
+                expression(depth - 1, allowStrings);
+                m_corpus += ')';
+            }
+        }
+
+        auto leaf(b8 const allowStrings) -> void {
+            if (allowStrings && chance(m_options.interpolationDensity)) {
+                m_corpus += "\"value ";
+                for (szt i = 0, n = 1 + pick(2); i < n; ++i) {
+                    m_corpus += '{';
+                    expression(pick(3), false);
+                    m_corpus += "} and ";
+                }
+                m_corpus += "more\"";
+                return;
+            }
+
+            switch (pick(6)) {
+            case 0:
+                m_corpus += std::format("{}", pick(100000));
+                return;
+            case 1:
+                m_corpus += std::format("0x{:x}", pick(1 << 16));
+                return;
+            case 2:
+                m_corpus += std::format("{}.{}", pick(1000), pick(100));
+                return;
+            case 3:
+                m_corpus += pick(2) == 0 ? "true" : "false";
+                return;
+            case 4:
+                m_corpus += "a";
+                return;
+            default:
+                m_corpus += std::format("x{}", pick(m_options.statementsPerFunction));
+            }
+        }
+
+    private:
+        CorpusOptions m_options;
+        std::mt19937_64 m_random;
+        Str m_corpus;
+    };
+
+    inline auto generateModule(CorpusOptions const& options) -> Str {
+        return ModuleGenerator{options}();
+    }
+
+    using ParseErrorCollector = ErrorCollector<
+        parse::EParseErrorContext, parse::EParseErrorReason
+    >;
+
+    // registers {source} with the SourceManager, for lexers that take a file
+    inline auto addSource(Str source) -> FileID {
+        return SourceManager::instance().add(
+            std::make_shared<SourceBuffer const>(std::move(source))
+        );
+    }
+
+    /**
+     * Lexes and parses {file}, which must be valid Toy: a generated corpus is
+     * only useful as long as it parses without errors.
+     */
+    inline auto parseCorpus(FileID const file) -> syntax::Node {
+        auto tree = parse::Parse::operator()(lex::Lex{file});
+        REQUIRE(ParseErrorCollector::instance().threadEmpty());
+        return tree;
+    }
+}
+
+#endif // TLC_TEST_PERFORMANCE_CORPUS_HPP
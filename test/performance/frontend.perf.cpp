@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "allocation.hpp"
+#include "baseline.hpp"
+#include "corpus.hpp"
+#include "measure.hpp"
+
+namespace {
+    auto countNodes(tlc::syntax::Node const& node) -> tlc::szt { // NOLINT(*-no-recursion)
+        return std::visit([]<typename T>(T const& alternative) -> tlc::szt {
+            if constexpr (requires { alternative.children(); }) {
+                tlc::szt count = 1;
+                for (auto const& child : alternative.children()) {
+                    count += countNodes(child);
+                }
+                return count;
+            }
+            else {
+                return 0;
+            }
+        }, node);
+    }
+
+    struct Workload {
+        tlc::StrV name;
+        tlc::test::CorpusOptions options;
+    };
+}
+
+TEST_CASE("Frontend: Throughput", "[Performance][Frontend]") {
+    using tlc::test::EMetricGoal;
+
+    auto const workloads = tlc::Arr<Workload, 3>{{
+        {"default", {.functions = 2000}},
+        {"deep", {.functions = 250, .expressionDepth = 7}},
+        {
+            "interpolated", {
+                .functions = 4000, .expressionDepth = 2,
+                .interpolationDensity = 0.5, .importDensity = 0.5,
+            }
+        },
+    }};
+
+    tlc::Vec<tlc::test::Metric> metrics;
+    for (auto const& [name, options] : workloads) {
+        auto const source = tlc::test::generateModule(options);
+        auto const file = tlc::test::addSource(source);
+        auto const megabytes = static_cast<tlc::f64>(source.size()) / (1 << 20);
+
+        auto const [tokens, lexStats] = tlc::test::countAllocations([&] {
+            return tlc::lex::Lex::operator()(file);
+        });
+        auto const [tree, parseStats] = tlc::test::countAllocations([&] {
+            return tlc::parse::Parse::operator()(tlc::lex::Lex{file});
+        });
+        // the generator is only useful as long as it emits valid Toy
+        REQUIRE(tlc::test::ParseErrorCollector::instance().threadEmpty());
+        auto const nodes = static_cast<tlc::f64>(countNodes(tree));
+        // a copy allocates exactly what the tree holds on the heap
+        auto const [copy, treeStats] = tlc::test::countAllocations([&] {
+            return tree;
+        });
+        auto const kilobytes = static_cast<tlc::f64>(source.size()) / (1 << 10);
+        auto const treeAllocations = static_cast<tlc::f64>(treeStats.count);
+
+        auto const lexSeconds = tlc::test::measure([&] {
+            return tlc::lex::Lex::operator()(file);
+        });
+        // the parser pulls its tokens from the lexer, so this includes lexing
+        auto const parseSeconds = tlc::test::measure([&] {
+            return tlc::parse::Parse::operator()(tlc::lex::Lex{file});
+        });
+        auto const astPrinterSeconds = tlc::test::measure([&] {
+            return tlc::parse::ASTPrinter::operator()(tree);
+        });
+        auto const prettyPrintSeconds = tlc::test::measure([&] {
+            return tlc::parse::PrettyPrint::operator()(tree);
+        });
+
+        auto const metric = [&](tlc::StrV const key, tlc::f64 const value,
+                                EMetricGoal const goal) {
+            metrics.push_back({std::format("frontend.{}.{}", name, key), value, goal});
+        };
+        metric("lex.mb_per_s", megabytes / lexSeconds, EMetricGoal::Higher);
+        metric(
+            "lex.tokens_per_s", static_cast<tlc::f64>(tokens.size()) / lexSeconds,
+            EMetricGoal::Higher
+        );
+        metric(
+            "lex.allocations", static_cast<tlc::f64>(lexStats.count),
+            EMetricGoal::Lower
+        );
+        metric("parse.nodes_per_s", nodes / parseSeconds, EMetricGoal::Higher);
+        metric(
+            "parse.allocations", static_cast<tlc::f64>(parseStats.count),
+            EMetricGoal::Lower
+        );
+        metric(
+            "tree.allocations_per_kb", treeAllocations / kilobytes,
+            EMetricGoal::Lower
+        );
+        metric(
+            "ast_printer.nodes_per_s", nodes / astPrinterSeconds,
+            EMetricGoal::Higher
+        );
+        metric(
+            "pretty_print.nodes_per_s", nodes / prettyPrintSeconds,
+            EMetricGoal::Higher
+        );
+    }
+
+    auto const peakMegabytes =
+        static_cast<tlc::f64>(tlc::test::peakResidentSetSize()) / (1 << 20);
+    metrics.push_back({"frontend.peak_rss_mb", peakMegabytes, EMetricGoal::Lower});
+
+    auto baseline = tlc::test::Baseline::fromEnvironment();
+    auto const regressions = baseline.check(metrics);
+    for (auto const& regression : regressions) {
+        UNSCOPED_INFO(regression);
+    }
+    INFO(std::format(
+        "more than {:.0f}% worse than {}",
+        baseline.threshold() * 100, baseline.path().string()
+    ));
+    REQUIRE(regressions.empty());
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "lex/lex.hpp"
+
+#include "corpus.hpp"
+
+namespace {
+    auto words(tlc::StrV const source) -> tlc::Vec<tlc::StrV> {
+        tlc::Vec<tlc::StrV> result;
+        for (tlc::szt begin = 0, end = 0; begin < source.size(); begin = end + 1) {
+            end = source.find_first_of(" \n", begin);
+            end = end == tlc::StrV::npos ? source.size() : end;
+            if (end > begin) {
+                result.push_back(source.substr(begin, end - begin));
+            }
+        }
+        return result;
+    }
+}
+
+TEST_CASE("Lex: Identifier classification", "[Performance][Lex]") {
+    using namespace tlc::lexeme;
+
+    auto const source = tlc::test::generateIdentifierCorpus(1 << 20);
+    auto const names = words(source);
+
+    // the lookup the perfect hash replaced
+    auto const keywords = keywordSpellings
+        | tlc::rv::transform([](auto const& entry) {
+            return tlc::Pair<tlc::StrV, Lexeme>{entry.second, Lexeme{entry.first}};
+        })
+        | tlc::rng::to<tlc::HashMap<tlc::StrV, Lexeme>>();
+    auto const fundamentalTypes = fundamentalTypeSpellings
+        | tlc::rng::to<tlc::HashSet<tlc::StrV>>();
+
+    auto const classifyWithHashMap = [&](tlc::StrV const name) {
+        if (name.front() >= 'a' && name.front() <= 'z') {
+            return keywords.contains(name) ? keywords.at(name) : identifier;
+        }
+        return fundamentalTypes.contains(name)
+            ? fundamentalType
+            : userDefinedType;
+    };
+
+    for (auto const name : names) {
+        auto const reserved = reservedName(name);
+        REQUIRE(classifyWithHashMap(name) == (
+            reserved != empty ? reserved :
+            name.front() >= 'a' && name.front() <= 'z' ? identifier : userDefinedType
+        ));
+    }
+
+    BENCHMARK("HashMap and HashSet") {
+        tlc::szt reserved = 0;
+        for (auto const name : names) {
+            auto const lexeme = classifyWithHashMap(name);
+            reserved += lexeme != identifier && lexeme != userDefinedType;
+        }
+        return reserved;
+    };
+
+    BENCHMARK("Perfect hash") {
+        tlc::szt reserved = 0;
+        for (auto const name : names) {
+            reserved += reservedName(name) != empty;
+        }
+        return reserved;
+    };
+
+    BENCHMARK("Lex identifier corpus") {
+        std::istringstream iss;
+        iss.str(source);
+        return tlc::lex::Lex::operator()(std::move(iss));
+    };
+}
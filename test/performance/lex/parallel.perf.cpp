@@ -0,0 +1,25 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <format>
+
+#include "corpus.hpp"
+
+TEST_CASE("Lex: Parallel scaling", "[Performance][Lex]") {
+    auto const file = tlc::test::addSource(tlc::test::generateCorpus(32 << 20));
+    auto const tokens = tlc::lex::Lex::operator()(file).size();
+
+    BENCHMARK("Lex serially") {
+        return tlc::lex::Lex::operator()(file);
+    };
+
+    auto const hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    for (tlc::szt threads = 1; threads <= hardwareThreads; threads *= 2) {
+        tlc::ThreadPool pool{threads};
+        REQUIRE(tlc::lex::Lex::operator()(file, pool).size() == tokens);
+
+        BENCHMARK(std::format("Lex on {} threads", threads)) {
+            return tlc::lex::Lex::operator()(file, pool);
+        };
+    }
+}
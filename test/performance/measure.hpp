@@ -0,0 +1,27 @@
+#ifndef TLC_TEST_PERFORMANCE_MEASURE_HPP
+#define TLC_TEST_PERFORMANCE_MEASURE_HPP
+
+#include "core/core.hpp"
+
+#include <chrono>
+
+namespace tlc::test {
+    // best of {runs} runs of f, in seconds
+    template <typename F>
+    auto measure(F&& f, szt const runs = 5) -> f64 {
+        auto best = std::numeric_limits<f64>::max();
+        for (szt run = 0; run < runs; ++run) {
+            auto const start = std::chrono::steady_clock::now();
+            [[maybe_unused]] auto const result = f();
+            best = std::min(
+                best,
+                std::chrono::duration<f64>(
+                    std::chrono::steady_clock::now() - start
+                ).count()
+            );
+        }
+        return best;
+    }
+}
+
+#endif // TLC_TEST_PERFORMANCE_MEASURE_HPP
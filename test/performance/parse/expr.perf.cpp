@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <format>
+
+#include "corpus.hpp"
+
+namespace {
+    /**
+     * {functions} functions each returning one flat chain of {operands}
+     * operands, cycling through every binary operator and negating every
+     * third operand, so nearly every other token is an operator.
+     */
+    auto operatorChains(tlc::szt const functions, tlc::szt const operands)
+        -> tlc::Str {
+        static constexpr auto prefixes = tlc::Arr<tlc::StrV, 3>{"-", "!", "~"};
+        auto const& binary = tlc::syntax::binaryOpPrecedenceTable;
+
+        tlc::Str source = "module bench.operators;\n";
+        for (tlc::szt i = 0; i < functions; ++i) {
+            source += std::format("\nfn f{}::(a: Int) -> (r: Int) {{\n    return x0", i);
+            for (tlc::szt j = 1; j < operands; ++j) {
+                source += std::format(
+                    " {} {}x{}", binary[(i + j) % binary.size()].first.str(),
+                    j % 3 == 0 ? prefixes[j % prefixes.size()] : "", j
+                );
+            }
+            source += ";\n}\n";
+        }
+        return source;
+    }
+
+    auto parse(tlc::FileID const file, tlc::b8 const recursive) -> tlc::syntax::Node {
+        tlc::parse::Parse parse{tlc::lex::Lex{file}};
+        parse.recursiveExpressions(recursive);
+        return parse();
+    }
+}
+
+TEST_CASE("Parse: Operator-heavy expressions", "[Performance][Parse][Expr]") {
+    auto const file = tlc::test::addSource(operatorChains(500, 64));
+    tlc::test::parseCorpus(file);
+
+    BENCHMARK("Lex and parse 500 chains of 64 operands") {
+        return tlc::parse::Parse::operator()(tlc::lex::Lex{file});
+    };
+
+    // what the expression parser asks about every token following an operand
+    BENCHMARK("Classify every lexeme") {
+        tlc::szt precedences = 0;
+        for (tlc::szt type = 0; type < tlc::lexeme::Lexeme::typeCount; ++type) {
+            tlc::lexeme::Lexeme const lexeme{
+                static_cast<tlc::lexeme::Lexeme::EType>(type)
+            };
+            if (tlc::syntax::isBinaryOperator(lexeme)) {
+                precedences += tlc::syntax::opPrecedence(
+                    lexeme, tlc::syntax::EOperator::Binary
+                );
+                precedences += tlc::syntax::isLeftAssociative(lexeme) ? 1 : 0;
+            }
+        }
+        return precedences;
+    };
+}
+
+TEST_CASE("Parse: Iterative and recursive expressions", "[Performance][Parse][Expr]") {
+    struct Workload {
+        tlc::StrV name;
+        tlc::Str source;
+    };
+
+    auto const workloads = tlc::Arr<Workload, 3>{{
+        {"operator chains", operatorChains(500, 64)},
+        {"long chains", operatorChains(20, 1000)},
+        {"module", tlc::test::generateModule({.functions = 2000})},
+    }};
+
+    for (auto const& [name, source] : workloads) {
+        auto const file = tlc::test::addSource(source);
+        REQUIRE(
+            tlc::parse::ASTPrinter::operator()(parse(file, false)) ==
+            tlc::parse::ASTPrinter::operator()(parse(file, true))
+        );
+        REQUIRE(tlc::test::ParseErrorCollector::instance().threadEmpty());
+
+        BENCHMARK(std::format("{}, recursive", name)) {
+            return parse(file, true);
+        };
+        BENCHMARK(std::format("{}, iterative", name)) {
+            return parse(file, false);
+        };
+    }
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <format>
+
+#include "corpus.hpp"
+
+namespace {
+    // statements whose first token is shared by a declaration and an
+    // expression, nesting tuples and records {depth} deep
+    auto nested(tlc::szt const depth) -> tlc::Str {
+        tlc::Str tuples, records, decls;
+        for (tlc::szt i = 0; i < depth; ++i) {
+            tuples += '(';
+            records += "geo.Point{x: (";
+            decls += '(';
+        }
+        tuples += 'x';
+        records += "{}";
+        decls += 'x';
+        for (tlc::szt i = 0; i < depth; ++i) {
+            tuples += std::format(", {})", i);
+            records += std::format(", y{}), y: [{}]}}", i, i);
+            decls += std::format(", y{}: Int)", i);
+        }
+
+        return std::format(
+            "module nested;\n"
+            "fn f::() -> () {{\n"
+            "    {} + 1;\n"
+            "    ({}, 0) == 1 => return;\n"
+            "    {} = x;\n"
+            "}}\n",
+            tuples, records, decls
+        );
+    }
+
+    auto parse(tlc::FileID const file, tlc::b8 const memoize)
+        -> tlc::Pair<tlc::szt, tlc::szt> {
+        tlc::parse::Parse parse{tlc::lex::Lex{file}};
+        for (auto const rule : {
+                 tlc::parse::ERule::DeclStmt, tlc::parse::ERule::TupleDecl,
+                 tlc::parse::ERule::TupleExpr, tlc::parse::ERule::RecordExpr
+             }) {
+            parse.memoize(rule, memoize);
+        }
+        parse();
+        tlc::test::ParseErrorCollector::instance().threadErrors();
+        return {parse.backtracks(), parse.memo().hits()};
+    }
+}
+
+TEST_CASE("Parse: Nested tuples and records", "[Performance][Parse]") {
+    for (tlc::szt depth = 8; depth <= 512; depth *= 4) {
+        auto const file = tlc::test::addSource(nested(depth));
+
+        // no rule is attempted twice at the same token, so the memo has
+        // nothing to replay; a hit means it is worth enabling again
+        auto const [backtracks, _] = parse(file, false);
+        auto const [memoBacktracks, hits] = parse(file, true);
+        REQUIRE(memoBacktracks == backtracks);
+        REQUIRE(hits == 0);
+
+        BENCHMARK(std::format("Depth {}", depth)) {
+            return parse(file, false);
+        };
+
+        BENCHMARK(std::format("Depth {}, memoized", depth)) {
+            return parse(file, true);
+        };
+    }
+}
@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "allocation.hpp"
+#include "corpus.hpp"
+
+namespace {
+    // the lookahead of the parser, done with views or with owning copies
+    // as peek() and current() used to return
+    template <typename T>
+    auto walk(tlc::token::TokenizedBuffer tokens) -> tlc::szt {
+        tlc::parse::TokenStream stream{std::move(tokens)};
+        tlc::szt length = 0;
+        for (stream.advance(); !stream.done(); stream.advance()) {
+            T const peeked{stream.peek()};
+            T const current{stream.current()};
+            length += peeked.str().size() + current.str().size();
+        }
+        return length;
+    }
+}
+
+TEST_CASE("TokenStream: Views", "[Performance][Parse]") {
+    auto const file = tlc::test::addSource(
+        tlc::test::generateModule({.functions = 2000})
+    );
+    auto const tokens = tlc::lex::Lex::operator()(file);
+
+    auto copy = tokens;
+    auto const [viewLength, viewStats] = tlc::test::countAllocations([&] {
+        return walk<tlc::token::TokenView>(std::move(copy));
+    });
+    copy = tokens;
+    auto const [tokenLength, tokenStats] = tlc::test::countAllocations([&] {
+        return walk<tlc::token::Token>(std::move(copy));
+    });
+    REQUIRE(viewLength == tokenLength);
+    CAPTURE(tokens.size(), viewStats.count, tokenStats.count);
+    // views never copy a spelling
+    REQUIRE(viewStats.count == 0);
+    tlc::test::parseCorpus(file);
+
+    BENCHMARK("Views") {
+        return walk<tlc::token::TokenView>(tokens);
+    };
+
+    BENCHMARK("Copies") {
+        return walk<tlc::token::Token>(tokens);
+    };
+
+    BENCHMARK("Lex and parse") {
+        return tlc::parse::Parse::operator()(tlc::lex::Lex{file});
+    };
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <format>
+
+#include "syntax/syntax.hpp"
+
+namespace {
+    // a complete binary tree of additions with 2^{depth} leaves
+    auto additions(tlc::szt const depth) -> tlc::syntax::Node { // NOLINT(*-no-recursion)
+        using namespace tlc::syntax;
+        if (depth == 0) {
+            return expr::Integer{1, {}};
+        }
+        return expr::Binary{
+            additions(depth - 1), additions(depth - 1), tlc::lexeme::plus, {}
+        };
+    }
+
+    // walks {iterations} times from the root to the leftmost leaf
+    template <typename F>
+    auto descend(tlc::syntax::Node const& root, tlc::szt const iterations, F access)
+        -> tlc::i64 {
+        tlc::i64 sum = 0;
+        for (tlc::szt i = 0; i < iterations; ++i) {
+            sum += access(root);
+        }
+        return sum;
+    }
+}
+
+TEST_CASE("AST access: Cost by subtree size", "[Performance][Syntax][Access]") {
+    using namespace tlc::syntax;
+
+    static constexpr tlc::szt iterations = 256;
+
+    auto const cast = [](Node const& node) {
+        auto const infer = astCast<type::Infer>(node);
+        auto const binary = astCast<expr::Binary>(infer.expr());
+        return astCast<expr::Binary>(binary.firstChild()).op() == tlc::lexeme::plus
+            ? tlc::i64{1} : tlc::i64{0};
+    };
+    auto const getIf = [](Node const& node) {
+        auto const* infer = astGetIf<type::Infer>(node);
+        auto const* binary = astGetIf<expr::Binary>(infer->expr());
+        return astGetIf<expr::Binary>(binary->firstChild())->op() == tlc::lexeme::plus
+            ? tlc::i64{1} : tlc::i64{0};
+    };
+
+    // astCast copies the subtree, astGetIf only reads it
+    for (tlc::szt depth = 2; depth <= 14; depth += 4) {
+        Node const root = type::Infer{additions(depth), {}};
+        auto const nodes = (tlc::szt{2} << depth) - 1;
+        REQUIRE(descend(root, 1, cast) == descend(root, 1, getIf));
+
+        BENCHMARK(std::format("astCast, {} nodes", nodes)) {
+            return descend(root, iterations, cast);
+        };
+        BENCHMARK(std::format("astGetIf, {} nodes", nodes)) {
+            return descend(root, iterations, getIf);
+        };
+    }
+}
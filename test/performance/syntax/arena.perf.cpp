@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "allocation.hpp"
+#include "corpus.hpp"
+
+namespace {
+    // time to destroy a copy of {value}, the copy itself excluded
+    template <typename T>
+    auto benchmarkDestruction(
+        Catch::Benchmark::Chronometer meter, T const& value
+    ) -> void {
+        tlc::Vec<Catch::Benchmark::destructable_object<T>> storage(meter.runs());
+        for (auto& object : storage) {
+            object.construct(value);
+        }
+        meter.measure([&](int const run) {
+            storage[static_cast<tlc::szt>(run)].destruct();
+        });
+    }
+}
+
+TEST_CASE("Arena: Memory per node", "[Performance][Syntax][Arena]") {
+    auto const file = tlc::test::addSource(
+        tlc::test::generateModule({.functions = 2000})
+    );
+    auto const tree = tlc::test::parseCorpus(file);
+
+    // a copy allocates exactly what the variant tree holds on the heap
+    auto const [copy, treeStats] = tlc::test::countAllocations([&] {
+        return tree;
+    });
+    auto const [arena, arenaStats] = tlc::test::countAllocations([&] {
+        return tlc::syntax::Arena{tree};
+    });
+
+    auto const nodes = static_cast<tlc::f64>(arena.size());
+    auto const treeBytes =
+        static_cast<tlc::f64>(treeStats.bytes + sizeof(tlc::syntax::Node));
+    auto const arenaBytes = static_cast<tlc::f64>(arena.bytes());
+    CAPTURE(nodes, treeBytes / nodes, arenaBytes / nodes);
+    CAPTURE(treeStats.count, arenaStats.count);
+
+    REQUIRE(arenaBytes < treeBytes);
+    REQUIRE(arenaStats.count * 100 < treeStats.count);
+    REQUIRE(
+        tlc::parse::ASTPrinter::operator()(arena, arena.root()) ==
+        tlc::parse::ASTPrinter::operator()(copy)
+    );
+
+    BENCHMARK("Copy into an arena") {
+        return tlc::syntax::Arena{tree};
+    };
+
+    BENCHMARK_ADVANCED("Destroy the variant tree")(
+        Catch::Benchmark::Chronometer meter
+    ) {
+        benchmarkDestruction(meter, tree);
+    };
+
+    BENCHMARK_ADVANCED("Destroy the arena")(Catch::Benchmark::Chronometer meter) {
+        benchmarkDestruction(meter, arena);
+    };
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "corpus.hpp"
+#include "measure.hpp"
+
+namespace {
+    // sum of the integer literals under {node}, following the variant tree
+    auto sumIntegers(tlc::syntax::Node const& node) -> tlc::i64 { // NOLINT(*-no-recursion)
+        return std::visit([]<typename T>(T const& alternative) -> tlc::i64 {
+            if constexpr (std::same_as<T, tlc::syntax::expr::Integer>) {
+                return alternative.value();
+            }
+            else if constexpr (std::derived_from<T, tlc::syntax::detail::NodeBase>) {
+                tlc::i64 sum = 0;
+                for (auto const& child : alternative.children()) {
+                    sum += sumIntegers(child);
+                }
+                return sum;
+            }
+            else {
+                return 0;
+            }
+        }, node);
+    }
+
+    // the same, following the child lists of an arena
+    auto sumIntegers(tlc::syntax::Arena const& tree, tlc::syntax::NodeId const id) // NOLINT(*-no-recursion)
+        -> tlc::i64 {
+        if (tree.holds<tlc::syntax::expr::Integer>(id)) {
+            return tree.payloads().integer(tree.payload(id));
+        }
+        tlc::i64 sum = 0;
+        for (auto const child : tree.children(id)) {
+            sum += sumIntegers(tree, child);
+        }
+        return sum;
+    }
+
+    // the same, scanning the kinds of an arena front to back
+    auto sumIntegers(tlc::syntax::Arena const& tree) -> tlc::i64 {
+        static constexpr auto integer =
+            tlc::syntax::nodeIndex<tlc::syntax::expr::Integer>;
+
+        tlc::i64 sum = 0;
+        auto const kinds = tree.kinds();
+        for (tlc::syntax::NodeId id = 0; id < kinds.size(); ++id) {
+            if (kinds[id] == integer) {
+                sum += tree.payloads().integer(tree.payload(id));
+            }
+        }
+        return sum;
+    }
+
+    // the same, visiting every node of an arena by its kind
+    auto visitIntegers(tlc::syntax::Arena const& tree) -> tlc::i64 {
+        using namespace tlc::syntax;
+
+        tlc::i64 sum = 0;
+        tree.visit([&]<typename T>(ArenaNode<T> const node) {
+            if constexpr (std::same_as<T, expr::Integer>) {
+                sum += node.arena().payloads().integer(node.payload());
+            }
+        });
+        return sum;
+    }
+}
+
+TEST_CASE("Flat tree: Full traversal", "[Performance][Syntax][FlatTree]") {
+    auto const file = tlc::test::addSource(
+        tlc::test::generateModule({.functions = 2000})
+    );
+    auto const tree = tlc::test::parseCorpus(file);
+    auto const flat = tlc::parse::Parse::flat(tlc::lex::Lex{file});
+
+    auto const expected = sumIntegers(tree);
+    REQUIRE(sumIntegers(flat, flat.root()) == expected);
+    REQUIRE(sumIntegers(flat) == expected);
+    REQUIRE(visitIntegers(flat) == expected);
+
+    // scanning the kinds is the point of the post-order layout
+    auto const variantSeconds = tlc::test::measure([&] {
+        return sumIntegers(tree);
+    });
+    auto const scanSeconds = tlc::test::measure([&] {
+        return sumIntegers(flat);
+    });
+    REQUIRE(scanSeconds < variantSeconds);
+
+    BENCHMARK("Variant tree") {
+        return sumIntegers(tree);
+    };
+
+    BENCHMARK("Arena, children") {
+        return sumIntegers(flat, flat.root());
+    };
+
+    BENCHMARK("Arena, scan") {
+        return sumIntegers(flat);
+    };
+
+    BENCHMARK("Arena, visit") {
+        return visitIntegers(flat);
+    };
+}
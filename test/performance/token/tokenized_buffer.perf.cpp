@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "allocation.hpp"
+#include "corpus.hpp"
+
+namespace {
+    auto lex(tlc::Str source) -> tlc::token::TokenizedBuffer {
+        std::istringstream iss;
+        iss.str(std::move(source));
+        return tlc::lex::Lex::operator()(std::move(iss));
+    }
+
+    // the array of self-contained tokens the buffer replaced
+    auto toTokenVector(tlc::token::TokenizedBuffer const& tokens)
+        -> tlc::Vec<tlc::token::Token> {
+        tlc::Vec<tlc::token::Token> result;
+        for (tlc::token::TokenIndex i = 0; i < tokens.size(); ++i) {
+            result.push_back(tokens[i]);
+        }
+        return result;
+    }
+}
+
+TEST_CASE("TokenizedBuffer: Footprint", "[Performance][Token]") {
+    auto const source = tlc::test::generateCorpus(1 << 20);
+
+    // the lexer takes over the storage of its input, keep the copy out of the count
+    auto input = source;
+    auto const [tokens, lexStats] = tlc::test::countAllocations([&] {
+        return lex(std::move(input));
+    });
+    auto const [vector, vectorStats] = tlc::test::countAllocations([&] {
+        return toTokenVector(tokens);
+    });
+    REQUIRE(vector.size() == tokens.size());
+
+    CAPTURE(tokens.size(), tokens.memoryUsage(), vectorStats.bytes);
+    CAPTURE(lexStats.count, vectorStats.count);
+    REQUIRE(tokens.memoryUsage() < vectorStats.bytes);
+}
+
+TEST_CASE("TokenizedBuffer: Lexing throughput", "[Performance][Token]") {
+    auto const source = tlc::test::generateCorpus(1 << 20);
+
+    BENCHMARK("Lex into TokenizedBuffer") {
+        return lex(source);
+    };
+
+    auto const tokens = lex(source);
+    BENCHMARK("Materialize Vec<Token>") {
+        return toTokenVector(tokens);
+    };
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/exception.hpp"
+#include "core/thread_pool.hpp"
+
+namespace {
+    enum class EContext { Unit };
+
+    enum class EReason { First, Second };
+
+    using Collector = tlc::ErrorCollector<EContext, EReason>;
+    using Error = Collector::TError;
+
+    auto summary(tlc::Span<Error const> const errors)
+        -> tlc::Vec<tlc::Tpl<tlc::Str, tlc::u32, EReason>> {
+        return errors | tlc::rv::transform([](Error const& error) {
+            return tlc::Tpl<tlc::Str, tlc::u32, EReason>{
+                error.filepath().string(), error.location().offset,
+                error.reason()
+            };
+        }) | tlc::rng::to<tlc::Vec<tlc::Tpl<tlc::Str, tlc::u32, EReason>>>();
+    }
+
+    // what parsing one unit would report, out of location order
+    auto collectUnit(tlc::FileID const file) -> void {
+        for (tlc::u32 const offset : {30u, 10u, 20u, 10u}) {
+            Collector::instance().collect({
+                .location = {offset, file},
+                .context = EContext::Unit,
+                .reason = offset == 10 ? EReason::Second : EReason::First,
+            });
+        }
+    }
+}
+
+TEST_CASE("ErrorCollector: Collection order on one thread", "[Core][ErrorCollector]") {
+    auto& collector = Collector::instance();
+    collector.collect({.location = {5, 0}, .context = EContext::Unit});
+    collector.collect({.location = {1, 0}, .context = EContext::Unit});
+
+    REQUIRE(collector.threadSize() == 2);
+    REQUIRE(collector.threadSince(1).front().location().offset == 1);
+
+    auto const errors = collector.threadErrors();
+    REQUIRE(errors.size() == 2);
+    REQUIRE(errors[0].location().offset == 5);
+    REQUIRE(errors[1].location().offset == 1);
+    REQUIRE(collector.threadEmpty());
+    REQUIRE(collector.merged().empty());
+}
+
+TEST_CASE("ErrorCollector: Deterministic merge", "[Core][ErrorCollector]") {
+    tlc::Vec<tlc::FileID> files;
+    for (auto const* const path : {"unit_c.toy", "unit_a.toy", "unit_b.toy"}) {
+        files.push_back(tlc::SourceManager::instance().add(
+            std::make_shared<tlc::SourceBuffer const>(tlc::Str{}), path
+        ));
+    }
+
+    tlc::Opt<decltype(summary({}))> expected;
+    for (tlc::szt const threads : {1uz, 2uz, 3uz, 8uz}) {
+        CAPTURE(threads);
+        {
+            tlc::ThreadPool pool{threads};
+            tlc::Vec<std::future<void>> units;
+            for (auto const file : files) {
+                units.push_back(pool.submit([file] {
+                    collectUnit(file);
+                }));
+            }
+            for (auto& unit : units) {
+                unit.get();
+            }
+        }
+
+        auto const merged = summary(Collector::instance().merged());
+        REQUIRE(merged.size() == 12);
+        REQUIRE(tlc::rng::is_sorted(merged));
+        REQUIRE(std::get<0>(merged.front()) == "unit_a.toy");
+        REQUIRE(std::get<0>(merged.back()) == "unit_c.toy");
+        if (expected) {
+            REQUIRE(merged == *expected);
+        }
+        expected = merged;
+    }
+}
+
+TEST_CASE("ErrorCollector: Merge by unit", "[Core][ErrorCollector]") {
+    // registered in reverse, so that FileIDs do not follow the units, and
+    // without paths, like in-memory sources
+    tlc::Vec<tlc::FileID> files(4);
+    for (auto& file : files | tlc::rv::reverse) {
+        file = tlc::SourceManager::instance().add(
+            std::make_shared<tlc::SourceBuffer const>(tlc::Str{})
+        );
+    }
+
+    for (tlc::szt const threads : {1uz, 2uz, 4uz}) {
+        CAPTURE(threads);
+        {
+            tlc::ThreadPool pool{threads};
+            tlc::Vec<std::future<void>> units;
+            for (tlc::u32 unit = 0; unit < files.size(); ++unit) {
+                units.push_back(pool.submit([unit, file = files[unit]] {
+                    Collector::instance().unit(unit);
+                    collectUnit(file);
+                }));
+            }
+            for (auto& unit : units) {
+                unit.get();
+            }
+        }
+
+        auto const merged = Collector::instance().merged();
+        REQUIRE(merged.size() == 16);
+        for (tlc::szt i = 0; i < merged.size(); ++i) {
+            REQUIRE(merged[i].location().file == files[i / 4]);
+        }
+    }
+}
+
+TEST_CASE("ErrorCollector: Errors of exited threads", "[Core][ErrorCollector]") {
+    for (tlc::u32 const offset : {2u, 1u, 3u}) {
+        std::jthread{[offset] {
+            Collector::instance().collect({
+                .location = {offset, 0}, .context = EContext::Unit,
+            });
+        }}.join();
+    }
+
+    auto const merged = Collector::instance().merged();
+    REQUIRE(merged.size() == 3);
+    REQUIRE(merged[0].location().offset == 1);
+    REQUIRE(merged[2].location().offset == 3);
+    REQUIRE(Collector::instance().merged().empty());
+}
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/interner.hpp"
+
+#include <thread>
+
+using tlc::Interner;
+using tlc::Symbol;
+
+TEST_CASE("Interner: Empty string", "[Core][Interner]") {
+    REQUIRE(Symbol{}.empty());
+    REQUIRE(Symbol{}.str().empty());
+    REQUIRE(Interner::instance().intern("") == Symbol{});
+    REQUIRE(Symbol{}.hash() == std::hash<tlc::StrV>{}(""));
+}
+
+TEST_CASE("Interner: Same string, same symbol", "[Core][Interner]") {
+    auto& interner = Interner::instance();
+    auto const symbol = interner.intern("identifier");
+
+    REQUIRE_FALSE(symbol.empty());
+    REQUIRE(symbol.str() == "identifier");
+    REQUIRE(symbol.hash() == std::hash<tlc::StrV>{}("identifier"));
+    REQUIRE(interner.intern(tlc::Str{"identifier"}) == symbol);
+    REQUIRE(interner.intern("identifier2") != symbol);
+    REQUIRE(std::hash<Symbol>{}(symbol) == symbol.hash());
+}
+
+TEST_CASE("Interner: Long strings", "[Core][Interner]") {
+    tlc::Str const str(100'000, 'x');
+    auto const symbol = Interner::instance().intern(str);
+
+    REQUIRE(symbol.str() == str);
+    REQUIRE(Interner::instance().intern(str) == symbol);
+}
+
+TEST_CASE("Interner: Concurrent interning", "[Core][Interner]") {
+    constexpr tlc::szt nThreads = 8;
+    constexpr tlc::szt nStrings = 10'000;
+
+    tlc::Vec<tlc::Vec<Symbol>> symbols(nThreads);
+    {
+        tlc::Vec<std::jthread> threads;
+        for (auto& interned : symbols) {
+            threads.emplace_back([&interned] {
+                for (tlc::szt i = 0; i < nStrings; ++i) {
+                    interned.push_back(Interner::instance().intern(
+                        "concurrent" + std::to_string(i)
+                    ));
+                }
+            });
+        }
+    }
+
+    for (auto const& interned : symbols) {
+        REQUIRE(interned == symbols.front());
+    }
+    for (tlc::szt i = 0; i < nStrings; ++i) {
+        REQUIRE(symbols.front()[i].str() == "concurrent" + std::to_string(i));
+    }
+}
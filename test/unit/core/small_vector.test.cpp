@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "core/small_vector.hpp"
+
+using tlc::SmallVec;
+
+TEST_CASE("SmallVec: Inline storage", "[Core][SmallVec]") {
+    SmallVec<tlc::u32, 2> values{1, 2};
+
+    REQUIRE(values.size() == 2);
+    REQUIRE(values.capacity() == 2);
+    REQUIRE(values.inlined());
+    REQUIRE(values.front() == 1);
+    REQUIRE(values.back() == 2);
+
+    SmallVec<tlc::u32, 2> const empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.inlined());
+    REQUIRE(empty.begin() == empty.end());
+}
+
+TEST_CASE("SmallVec: Growing past the inline capacity", "[Core][SmallVec]") {
+    SmallVec<tlc::u32, 2> values;
+    for (tlc::u32 i = 0; i < 100; ++i) {
+        values.push_back(i);
+        REQUIRE(values.inlined() == (i < 2));
+    }
+
+    REQUIRE(values.size() == 100);
+    REQUIRE(values.capacity() >= 100);
+    for (tlc::u32 i = 0; i < 100; ++i) {
+        REQUIRE(values[i] == i);
+    }
+
+    // elements of the vector itself are copied before it reallocates
+    values.push_back(values.front());
+    REQUIRE(values.back() == 0);
+
+    values.clear();
+    REQUIRE(values.empty());
+    REQUIRE(values.capacity() >= 100);
+}
+
+TEST_CASE("SmallVec: Copy and move", "[Core][SmallVec]") {
+    auto const source = GENERATE(tlc::szt{1}, tlc::szt{2}, tlc::szt{10});
+
+    SmallVec<tlc::u32, 2> values;
+    for (tlc::u32 i = 0; i < source; ++i) {
+        values.push_back(i);
+    }
+
+    auto copy = values;
+    REQUIRE(copy == values);
+    copy[0] = 42;
+    REQUIRE(values[0] == 0);
+
+    auto moved = std::move(copy);
+    REQUIRE(moved.size() == source);
+    REQUIRE(moved[0] == 42);
+    REQUIRE(copy.empty()); // NOLINT(*-use-after-move)
+    REQUIRE(copy.inlined());
+
+    copy = moved;
+    REQUIRE(copy == moved);
+    moved = std::move(values);
+    REQUIRE(moved[0] == 0);
+    REQUIRE(tlc::Span<tlc::u32 const>{moved}.size() == source);
+}
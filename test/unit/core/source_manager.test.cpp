@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/source_manager.hpp"
+
+#include <fstream>
+
+using tlc::SourceManager;
+
+namespace {
+    auto add(tlc::Str source) -> tlc::FileID {
+        return SourceManager::instance().add(
+            std::make_shared<tlc::SourceBuffer const>(std::move(source))
+        );
+    }
+
+    auto location(tlc::FileID const file, tlc::u32 const offset) -> tlc::Location {
+        return SourceManager::instance().location({offset, file});
+    }
+}
+
+TEST_CASE("SourceManager: Files", "[Core][SourceManager]") {
+    auto const first = add("first");
+    auto const second = add("second");
+
+    REQUIRE(first != SourceManager::noFile);
+    REQUIRE(first != second);
+    REQUIRE(SourceManager::instance().buffer(first)->view() == "first");
+    REQUIRE(SourceManager::instance().buffer(second)->view() == "second");
+    REQUIRE(SourceManager::instance().buffer(SourceManager::noFile) == nullptr);
+}
+
+TEST_CASE("SourceManager: Lines and columns", "[Core][SourceManager]") {
+    auto const file = add("let x\n\tfoo\r\n\n  \tbar");
+
+    auto const assertLocation = [&](
+        tlc::u32 const offset, tlc::szt const line, tlc::szt const column
+    ) {
+        CAPTURE(offset, line, column);
+        auto const [actualLine, actualColumn] = location(file, offset);
+        REQUIRE(actualLine == line);
+        REQUIRE(actualColumn == column);
+    };
+
+    assertLocation(0, 0, 0);
+    assertLocation(4, 0, 4);
+    assertLocation(5, 0, 5);
+    assertLocation(6, 1, 0);
+    assertLocation(7, 1, 4);
+    assertLocation(10, 1, 7);
+    assertLocation(12, 2, 0);
+    assertLocation(16, 3, 6);
+    assertLocation(18, 3, 8);
+}
+
+TEST_CASE("SourceManager: Default locations", "[Core][SourceManager]") {
+    auto const [line, column] = SourceManager::instance().location({});
+    REQUIRE(line == 0);
+    REQUIRE(column == 0);
+}
+
+TEST_CASE("SourceManager: Loaded files", "[Core][SourceManager]") {
+    auto const directory = tlc::fs::temp_directory_path() / "tlc-source-manager";
+    tlc::fs::create_directories(directory / "nested");
+    auto const filepath = directory / "loaded.toy";
+    std::ofstream{filepath} << "fn main() {}\n";
+
+    auto const file = SourceManager::instance().load(filepath);
+    auto const again = SourceManager::instance().load(
+        directory / "nested" / ".." / "loaded.toy"
+    );
+
+    REQUIRE(file != SourceManager::noFile);
+    REQUIRE(file == again);
+    REQUIRE(SourceManager::instance().path(file) == filepath);
+    REQUIRE(SourceManager::instance().buffer(file)->view() == "fn main() {}\n");
+    REQUIRE(SourceManager::instance().path(SourceManager::noFile).empty());
+}
+
+TEST_CASE("SourceManager: Snippets", "[Core][SourceManager]") {
+    auto const file = add("let x\r\n  foo bar\nlast");
+
+    REQUIRE(SourceManager::instance().snippet({0, file}) == "let x");
+    REQUIRE(SourceManager::instance().snippet({11, file}) == "  foo bar");
+    REQUIRE(SourceManager::instance().snippet({19, file}) == "last");
+    REQUIRE(SourceManager::instance().snippet({}).empty());
+}
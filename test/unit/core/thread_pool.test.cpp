@@ -0,0 +1,32 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/thread_pool.hpp"
+
+#include <atomic>
+
+TEST_CASE("ThreadPool: Results", "[Core][ThreadPool]") {
+    tlc::ThreadPool pool{4};
+    REQUIRE(pool.size() == 4);
+
+    tlc::Vec<std::future<tlc::szt>> results;
+    for (tlc::szt i = 0; i < 100; ++i) {
+        results.push_back(pool.submit([i] { return i * i; }));
+    }
+    for (tlc::szt i = 0; i < results.size(); ++i) {
+        REQUIRE(results[i].get() == i * i);
+    }
+
+    auto failed = pool.submit([]() -> int { throw std::runtime_error{"failed"}; });
+    REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+}
+
+TEST_CASE("ThreadPool: Queued tasks finish on destruction", "[Core][ThreadPool]") {
+    std::atomic<tlc::szt> count = 0;
+    {
+        tlc::ThreadPool pool{2};
+        for (tlc::szt i = 0; i < 1000; ++i) {
+            pool.submit([&count] { ++count; });
+        }
+    }
+    REQUIRE(count == 1000);
+}
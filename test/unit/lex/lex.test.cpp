@@ -1,6 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <format>
+
 #include "lex/lex.hpp"
+#include "lex/split.hpp"
 
 // todo: test cases for lexing errors
 
@@ -13,7 +16,7 @@ protected:
     }
 
     auto assertTokenAt(
-        tlc::szt const i, tlc::lexeme::Lexeme const& lexeme, tlc::StrV const str,
+        tlc::szt const i, tlc::lexeme::Lexeme const lexeme, tlc::StrV const str,
         tlc::szt const line, tlc::szt const column
     ) const -> void {
         CAPTURE(i);
@@ -24,6 +27,15 @@ protected:
         REQUIRE(m_tokens[i].column() == column);
     }
 
+    auto assertValueAt(
+        tlc::szt const i, tlc::token::NumericValue const& value
+    ) const -> void {
+        CAPTURE(i);
+        REQUIRE(i < m_tokens.size());
+        REQUIRE(m_tokens.value(i) == value);
+        REQUIRE(m_tokens[i].value() == value);
+    }
+
     auto assertTokenCount(tlc::szt const count) const -> void {
         REQUIRE(count == m_tokens.size());
     }
@@ -49,6 +61,28 @@ foo Bar    Float
     assertTokenAt(3, tlc::lexeme::module_, "module", 3, 4);
 }
 
+TEST_CASE_WITH_FIXTURE("Lex: Long runs", "[Lex]") {
+    lex(
+        "\n\t  abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+        "                                       \n"
+        "\"a string fragment that is longer than thirty-two bytes{x}\\tend\""
+    );
+
+    assertTokenCount(6);
+    assertTokenAt(
+        0, tlc::lexeme::identifier,
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", 1, 6
+    );
+    assertTokenAt(
+        1, tlc::lexeme::stringFragment,
+        "a string fragment that is longer than thirty-two bytes", 2, 0
+    );
+    assertTokenAt(2, tlc::lexeme::placeholderBegin, "{", 2, 55);
+    assertTokenAt(3, tlc::lexeme::identifier, "x", 2, 56);
+    assertTokenAt(4, tlc::lexeme::placeholderEnd, "}", 2, 57);
+    assertTokenAt(5, tlc::lexeme::stringFragment, "\tend", 2, 58);
+}
+
 TEST_CASE_WITH_FIXTURE("Lex: Comments", "[Lex]") {}
 
 TEST_CASE_WITH_FIXTURE("Lex: Identifiers and keywords", "[Lex]") {
@@ -330,6 +364,30 @@ TEST_CASE_WITH_FIXTURE("Lex: Numbers", "[Lex]") {
     }
 }
 
+TEST_CASE_WITH_FIXTURE("Lex: Numeric values", "[Lex]") {
+    using tlc::token::NumericValue;
+
+    lex(R"(
+31415 0 3.25 03.5 0b1010 017 0x1f 0x7fffffffffffffff
+9223372036854775808 0x8000000000000000 x
+    )");
+
+    assertTokenCount(11);
+    assertValueAt(0, NumericValue{tlc::i64{31415}});
+    assertValueAt(1, NumericValue{tlc::i64{0}});
+    assertValueAt(2, NumericValue{3.25});
+    assertValueAt(3, NumericValue{3.5});
+    assertValueAt(4, NumericValue{tlc::i64{10}});
+    assertValueAt(5, NumericValue{tlc::i64{15}});
+    assertValueAt(6, NumericValue{tlc::i64{31}});
+    assertValueAt(7, NumericValue{std::numeric_limits<tlc::i64>::max()});
+    // out of range
+    assertValueAt(8, NumericValue{});
+    assertValueAt(9, NumericValue{});
+    // not a number
+    assertValueAt(10, NumericValue{});
+}
+
 TEST_CASE_WITH_FIXTURE("Lex: Symbols", "[Lex]") {
     SECTION("Single character") {
         lex(R"(
@@ -461,6 +519,33 @@ $
         assertTokenAt(2, tlc::lexeme::star2Equal, "**=", 3, 0);
         assertTokenAt(3, tlc::lexeme::dot3, "...", 4, 0);
     }
+
+    SECTION("Adjacent symbols") {
+        lex(R"(
+x>>==y|>_....
+        )");
+
+        assertTokenCount(8);
+        assertTokenAt(1, tlc::lexeme::greater2Equal, ">>=", 1, 1);
+        assertTokenAt(2, tlc::lexeme::equal, "=", 1, 4);
+        assertTokenAt(4, tlc::lexeme::barGreater, "|>", 1, 6);
+        assertTokenAt(5, tlc::lexeme::anonymous, "_", 1, 8);
+        assertTokenAt(6, tlc::lexeme::dot3, "...", 1, 9);
+        assertTokenAt(7, tlc::lexeme::dot, ".", 1, 12);
+    }
+
+    SECTION("Unlexed double characters") {
+        lex(R"(
+!!x
+a<-1
+        )");
+
+        assertTokenCount(7);
+        assertTokenAt(0, tlc::lexeme::exclaim, "!", 1, 0);
+        assertTokenAt(1, tlc::lexeme::exclaim, "!", 1, 1);
+        assertTokenAt(4, tlc::lexeme::less, "<", 2, 1);
+        assertTokenAt(5, tlc::lexeme::minus, "-", 2, 2);
+    }
 }
 
 TEST_CASE_WITH_FIXTURE("Lex: Strings", "[Lex]") {
@@ -487,10 +572,11 @@ TEST_CASE_WITH_FIXTURE("Lex: Strings", "[Lex]") {
 "{}"
                 )");
 
-        assertTokenCount(3);
+        assertTokenCount(4);
         assertTokenAt(0, tlc::lexeme::stringFragment, "", 1, 0);
-        assertTokenAt(1, tlc::lexeme::stringPlaceholder, "", 1, 1);
-        assertTokenAt(2, tlc::lexeme::stringFragment, "", 1, 3);
+        assertTokenAt(1, tlc::lexeme::placeholderBegin, "{", 1, 1);
+        assertTokenAt(2, tlc::lexeme::placeholderEnd, "}", 1, 2);
+        assertTokenAt(3, tlc::lexeme::stringFragment, "", 1, 3);
     }
 
     SECTION("Placeholder at the beginning") {
@@ -498,12 +584,16 @@ TEST_CASE_WITH_FIXTURE("Lex: Strings", "[Lex]") {
 "{x}{5}text"
                 )");
 
-        assertTokenCount(5);
+        assertTokenCount(9);
         assertTokenAt(0, tlc::lexeme::stringFragment, "", 1, 0);
-        assertTokenAt(1, tlc::lexeme::stringPlaceholder, "x", 1, 1);
-        assertTokenAt(2, tlc::lexeme::stringFragment, "", 1, 4);
-        assertTokenAt(3, tlc::lexeme::stringPlaceholder, "5", 1, 4);
-        assertTokenAt(4, tlc::lexeme::stringFragment, "text", 1, 7);
+        assertTokenAt(1, tlc::lexeme::placeholderBegin, "{", 1, 1);
+        assertTokenAt(2, tlc::lexeme::identifier, "x", 1, 2);
+        assertTokenAt(3, tlc::lexeme::placeholderEnd, "}", 1, 3);
+        assertTokenAt(4, tlc::lexeme::stringFragment, "", 1, 4);
+        assertTokenAt(5, tlc::lexeme::placeholderBegin, "{", 1, 4);
+        assertTokenAt(6, tlc::lexeme::integer10Literal, "5", 1, 5);
+        assertTokenAt(7, tlc::lexeme::placeholderEnd, "}", 1, 6);
+        assertTokenAt(8, tlc::lexeme::stringFragment, "text", 1, 7);
     }
 
     SECTION("Placeholder at the end") {
@@ -511,12 +601,16 @@ TEST_CASE_WITH_FIXTURE("Lex: Strings", "[Lex]") {
 "text{""}{"inner"}"
                     )");
 
-        assertTokenCount(5);
+        assertTokenCount(9);
         assertTokenAt(0, tlc::lexeme::stringFragment, "text", 1, 0);
-        assertTokenAt(1, tlc::lexeme::stringPlaceholder, "\"\"", 1, 5);
-        assertTokenAt(2, tlc::lexeme::stringFragment, "", 1, 9);
-        assertTokenAt(3, tlc::lexeme::stringPlaceholder, "\"inner\"", 1, 9);
-        assertTokenAt(4, tlc::lexeme::stringFragment, "", 1, 18);
+        assertTokenAt(1, tlc::lexeme::placeholderBegin, "{", 1, 5);
+        assertTokenAt(2, tlc::lexeme::stringFragment, "", 1, 6);
+        assertTokenAt(3, tlc::lexeme::placeholderEnd, "}", 1, 8);
+        assertTokenAt(4, tlc::lexeme::stringFragment, "", 1, 9);
+        assertTokenAt(5, tlc::lexeme::placeholderBegin, "{", 1, 9);
+        assertTokenAt(6, tlc::lexeme::stringFragment, "inner", 1, 10);
+        assertTokenAt(7, tlc::lexeme::placeholderEnd, "}", 1, 17);
+        assertTokenAt(8, tlc::lexeme::stringFragment, "", 1, 18);
     }
 
     SECTION("Placeholder in the middle") {
@@ -524,10 +618,11 @@ TEST_CASE_WITH_FIXTURE("Lex: Strings", "[Lex]") {
 "left{}right"
                     )");
 
-        assertTokenCount(3);
+        assertTokenCount(4);
         assertTokenAt(0, tlc::lexeme::stringFragment, "left", 1, 0);
-        assertTokenAt(1, tlc::lexeme::stringPlaceholder, "", 1, 5);
-        assertTokenAt(2, tlc::lexeme::stringFragment, "right", 1, 7);
+        assertTokenAt(1, tlc::lexeme::placeholderBegin, "{", 1, 5);
+        assertTokenAt(2, tlc::lexeme::placeholderEnd, "}", 1, 6);
+        assertTokenAt(3, tlc::lexeme::stringFragment, "right", 1, 7);
     }
 
     SECTION("{x}+{y}={x+y}") {
@@ -535,13 +630,88 @@ TEST_CASE_WITH_FIXTURE("Lex: Strings", "[Lex]") {
 "{x}+{y}={x+y}"
                     )");
 
-        assertTokenCount(7);
+        assertTokenCount(15);
+        assertTokenAt(0, tlc::lexeme::stringFragment, "", 1, 0);
+        assertTokenAt(1, tlc::lexeme::placeholderBegin, "{", 1, 1);
+        assertTokenAt(2, tlc::lexeme::identifier, "x", 1, 2);
+        assertTokenAt(3, tlc::lexeme::placeholderEnd, "}", 1, 3);
+        assertTokenAt(4, tlc::lexeme::stringFragment, "+", 1, 4);
+        assertTokenAt(5, tlc::lexeme::placeholderBegin, "{", 1, 5);
+        assertTokenAt(6, tlc::lexeme::identifier, "y", 1, 6);
+        assertTokenAt(7, tlc::lexeme::placeholderEnd, "}", 1, 7);
+        assertTokenAt(8, tlc::lexeme::stringFragment, "=", 1, 8);
+        assertTokenAt(9, tlc::lexeme::placeholderBegin, "{", 1, 9);
+        assertTokenAt(10, tlc::lexeme::identifier, "x", 1, 10);
+        assertTokenAt(11, tlc::lexeme::plus, "+", 1, 11);
+        assertTokenAt(12, tlc::lexeme::identifier, "y", 1, 12);
+        assertTokenAt(13, tlc::lexeme::placeholderEnd, "}", 1, 13);
+        assertTokenAt(14, tlc::lexeme::stringFragment, "", 1, 14);
+    }
+
+    SECTION("Placeholder spanning lines") {
+        lex(R"(
+"{ Point{x: 1,
+   y: "}"} }"
+                    )");
+
+        assertTokenCount(14);
         assertTokenAt(0, tlc::lexeme::stringFragment, "", 1, 0);
-        assertTokenAt(1, tlc::lexeme::stringPlaceholder, "x", 1, 1);
-        assertTokenAt(2, tlc::lexeme::stringFragment, "+", 1, 4);
-        assertTokenAt(3, tlc::lexeme::stringPlaceholder, "y", 1, 5);
-        assertTokenAt(4, tlc::lexeme::stringFragment, "=", 1, 8);
-        assertTokenAt(5, tlc::lexeme::stringPlaceholder, "x+y", 1, 9);
-        assertTokenAt(6, tlc::lexeme::stringFragment, "", 1, 14);
+        assertTokenAt(1, tlc::lexeme::placeholderBegin, "{", 1, 1);
+        assertTokenAt(2, tlc::lexeme::userDefinedType, "Point", 1, 3);
+        assertTokenAt(3, tlc::lexeme::leftBrace, "{", 1, 8);
+        assertTokenAt(4, tlc::lexeme::identifier, "x", 1, 9);
+        assertTokenAt(5, tlc::lexeme::colon, ":", 1, 10);
+        assertTokenAt(6, tlc::lexeme::integer10Literal, "1", 1, 12);
+        assertTokenAt(7, tlc::lexeme::comma, ",", 1, 13);
+        assertTokenAt(8, tlc::lexeme::identifier, "y", 2, 3);
+        assertTokenAt(9, tlc::lexeme::colon, ":", 2, 4);
+        assertTokenAt(10, tlc::lexeme::stringFragment, "}", 2, 6);
+        assertTokenAt(11, tlc::lexeme::rightBrace, "}", 2, 9);
+        assertTokenAt(12, tlc::lexeme::placeholderEnd, "}", 2, 11);
+        assertTokenAt(13, tlc::lexeme::stringFragment, "", 2, 12);
+    }
+}
+
+TEST_CASE_WITH_FIXTURE("Lex: Split at safe newlines", "[Lex]") {
+    using tlc::lex::splitAtSafeNewlines;
+    using Offsets = tlc::Vec<tlc::szt>;
+
+    // the newlines inside the placeholder are not safe
+    auto const source = tlc::StrV{"a\n\"b{\nc\n}d\"\ne\nf"};
+
+    REQUIRE(splitAtSafeNewlines(source, 15) == Offsets{0, 2, 12, 14, 15});
+    REQUIRE(splitAtSafeNewlines(source, 3) == Offsets{0, 12, 15});
+    REQUIRE(splitAtSafeNewlines(source, 1) == Offsets{0, 15});
+    REQUIRE(splitAtSafeNewlines("a\r\nb\nc\nd", 4) == Offsets{0, 8});
+    REQUIRE(splitAtSafeNewlines("", 4) == Offsets{0});
+}
+
+TEST_CASE_WITH_FIXTURE("Lex: Parallel", "[Lex]") {
+    tlc::Str source;
+    for (tlc::szt i = 0; source.size() < 1 << 20; ++i) {
+        source += std::format(
+            "let x{0}: Int = 0x{0:x} + foo(y{0}, 2.5);\n"
+            "print(\"line {{x{0} +\n y}} \\\"quoted\\\" {{\"{{nested}}\"}}\");\n"
+            "\\ comment {0}\n",
+            i
+        );
+    }
+    auto const file = tlc::SourceManager::instance().add(
+        std::make_shared<tlc::SourceBuffer const>(source)
+    );
+
+    auto const serial = tlc::lex::Lex::operator()(file);
+    tlc::ThreadPool pool{4};
+    auto const parallel = tlc::lex::Lex::operator()(file, pool);
+
+    REQUIRE(tlc::lex::splitAtSafeNewlines(source, 16).size() == 17);
+    REQUIRE(parallel.size() == serial.size());
+    for (tlc::token::TokenIndex i = 0; i < serial.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE(parallel.kind(i) == serial.kind(i));
+        REQUIRE(parallel.offset(i) == serial.offset(i));
+        REQUIRE(parallel.length(i) == serial.length(i));
+        REQUIRE(parallel.str(i) == serial.str(i));
+        REQUIRE(parallel.symbol(i) == serial.symbol(i));
     }
 }
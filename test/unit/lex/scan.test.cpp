@@ -0,0 +1,52 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "lex/scan.hpp"
+
+namespace {
+    constexpr auto simdLevels = std::array{
+        tlc::lex::ESimdLevel::Scalar,
+        tlc::lex::ESimdLevel::SSE2,
+        tlc::lex::ESimdLevel::AVX2,
+    };
+
+    // runs long enough to cross every 16-byte and 32-byte chunk boundary
+    auto assertScan(
+        tlc::szt (*scan)(tlc::StrV, tlc::lex::ESimdLevel),
+        tlc::StrV const run, tlc::StrV const stops
+    ) -> void {
+        for (tlc::szt length = 0; length <= 70; ++length) {
+            for (auto const stop : stops) {
+                auto text = tlc::Str{};
+                while (text.size() < length) {
+                    text += run.substr(0, length - text.size());
+                }
+                text += stop;
+                text += run;
+
+                for (auto const level : simdLevels) {
+                    CAPTURE(length, stop, static_cast<int>(level));
+                    REQUIRE(scan(text, level) == length);
+                    REQUIRE(scan(tlc::StrV{text}.substr(0, length), level) == length);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Scan: Spaces", "[Lex][Scan]") {
+    assertScan(tlc::lex::scanSpaces, " \t\n  ", "\rx0\"{\x80");
+}
+
+TEST_CASE("Scan: Identifiers", "[Lex][Scan]") {
+    assertScan(
+        tlc::lex::scanIdentifier, "abcxyzABCXYZ0189",
+        " _@[`{/:\"\x80\xff"
+    );
+}
+
+TEST_CASE("Scan: String fragments", "[Lex][Scan]") {
+    assertScan(
+        tlc::lex::scanStringFragment, "hello, world!\t}'_\x80\xff",
+        "\"\\{\n\r"
+    );
+}
@@ -2,6 +2,8 @@
 
 #include "lex/text_stream.hpp"
 
+#include <fstream>
+
 class TextStreamTestFixture {
 protected:
     auto readFromSource(tlc::Str source) -> void {
@@ -10,15 +12,24 @@ protected:
         m_stream = tlc::lex::TextStream{std::move(iss)};
     }
 
-    auto assertCurrentThenAdvance(
-        tlc::c8 const c, tlc::szt const line, tlc::szt const column
-    ) -> void {
-        CAPTURE(c, line, column);
+    auto readFromFile(tlc::Str const& source) -> void {
+        auto const filepath = tlc::fs::temp_directory_path() /
+            "tlc_test_unit_lex_text_stream.toy";
+        {
+            std::ofstream ofs{filepath, std::ios::binary};
+            ofs << source;
+        }
+        m_stream = tlc::lex::TextStream{filepath};
+        tlc::fs::remove(filepath);
+    }
+
+    auto assertCurrentThenAdvance(tlc::c8 const c, tlc::szt const offset)
+        -> void {
+        CAPTURE(c, offset);
         REQUIRE(m_stream.peek() == c);
         REQUIRE(m_stream.match(c));
         REQUIRE(m_stream.current() == c);
-        REQUIRE(m_stream.line() == line);
-        REQUIRE(m_stream.column() == column);
+        REQUIRE(m_stream.offset() == offset);
     }
 
     [[nodiscard]] auto done() const -> bool {
@@ -37,19 +48,40 @@ TEST_CASE_WITH_FIXTURE("TextStream: Peek and match", "[Lex][TextStream]") {
 str eam)");
 
     // "lex"
-    assertCurrentThenAdvance('l', 0, 0);
-    assertCurrentThenAdvance('e', 0, 1);
-    assertCurrentThenAdvance('x', 0, 2);
-    assertCurrentThenAdvance('\n', 0, 3);
+    assertCurrentThenAdvance('l', 0);
+    assertCurrentThenAdvance('e', 1);
+    assertCurrentThenAdvance('x', 2);
+    assertCurrentThenAdvance('\n', 3);
+
+    // "stream"
+    assertCurrentThenAdvance('s', 4);
+    assertCurrentThenAdvance('t', 5);
+    assertCurrentThenAdvance('r', 6);
+    assertCurrentThenAdvance(' ', 7);
+    assertCurrentThenAdvance('e', 8);
+    assertCurrentThenAdvance('a', 9);
+    assertCurrentThenAdvance('m', 10);
+
+    REQUIRE(done());
+}
+
+TEST_CASE_WITH_FIXTURE("TextStream: Read from file", "[Lex][TextStream]") {
+    readFromFile("lex\nstr\team");
+
+    // "lex"
+    assertCurrentThenAdvance('l', 0);
+    assertCurrentThenAdvance('e', 1);
+    assertCurrentThenAdvance('x', 2);
+    assertCurrentThenAdvance('\n', 3);
 
     // "stream"
-    assertCurrentThenAdvance('s', 1, 0);
-    assertCurrentThenAdvance('t', 1, 1);
-    assertCurrentThenAdvance('r', 1, 2);
-    assertCurrentThenAdvance(' ', 1, 3);
-    assertCurrentThenAdvance('e', 1, 4);
-    assertCurrentThenAdvance('a', 1, 5);
-    assertCurrentThenAdvance('m', 1, 6);
+    assertCurrentThenAdvance('s', 4);
+    assertCurrentThenAdvance('t', 5);
+    assertCurrentThenAdvance('r', 6);
+    assertCurrentThenAdvance('\t', 7);
+    assertCurrentThenAdvance('e', 8);
+    assertCurrentThenAdvance('a', 9);
+    assertCurrentThenAdvance('m', 10);
 
     REQUIRE(done());
 }
@@ -0,0 +1,121 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "parse/parse.hpp"
+
+class BacktrackTestFixture {
+protected:
+    using ErrCollector = tlc::ErrorCollector<
+        tlc::parse::EParseErrorContext, tlc::parse::EParseErrorReason
+    >;
+
+    struct Count {
+        tlc::szt backtracks, tokens;
+    };
+
+    // every kind of statement and primary expression, repeated
+    static auto source(tlc::szt const functions) -> tlc::Str {
+        static constexpr auto function = tlc::StrV{
+            "fn f::(a: Int, b: Float) -> (r: Int) {\n"
+            "    x = a;\n"
+            "    y: Int = a + b * 2;\n"
+            "    (u, v: Bool) = (0, 0.0);\n"
+            "    foo.bar(x, [1, 2], geo.Point{x: 1, y: true});\n"
+            "    x += -a * (b + c) - d;\n"
+            "    x == y => return \"a{b}c\";\n"
+            "    for e in r { defer io.println(e); }\n"
+            "    match x { 0 => return 1; _ => {} }\n"
+            "    return try foo(x);\n"
+            "}\n"
+        };
+
+        tlc::Str result = "module backtrack;\n";
+        for (tlc::szt i = 0; i < functions; ++i) {
+            result += function;
+        }
+        return result;
+    }
+
+    using Located = tlc::Pair<tlc::u32, tlc::parse::EParseErrorReason>;
+
+    struct Parsed {
+        tlc::Str astPrint;
+        tlc::Vec<Located> errors;
+        tlc::szt memoized;
+    };
+
+    static auto parse(tlc::Str source, tlc::b8 const memoize) -> Parsed {
+        using tlc::parse::ERule;
+
+        std::istringstream iss;
+        iss.str(std::move(source));
+        tlc::parse::Parse parse{tlc::lex::Lex{std::move(iss)}};
+        for (auto const rule : {
+                 ERule::DeclStmt, ERule::TupleDecl, ERule::TupleExpr,
+                 ERule::RecordExpr
+             }) {
+            parse.memoize(rule, memoize);
+        }
+
+        auto const tree = parse();
+        auto const errors = ErrCollector::instance().threadErrors()
+            | tlc::rv::transform([](auto const& error) {
+                return Located{error.location().offset, error.reason()};
+            })
+            | tlc::rng::to<tlc::Vec<Located>>();
+        return {
+            tlc::parse::ASTPrinter::operator()(tree), errors,
+            parse.memo().size()
+        };
+    }
+
+    static auto count(tlc::szt const functions) -> Count {
+        auto const tokens = [&] {
+            std::istringstream iss;
+            iss.str(source(functions));
+            return tlc::lex::Lex::operator()(std::move(iss));
+        }();
+
+        std::istringstream iss;
+        iss.str(source(functions));
+        tlc::parse::Parse parse{tlc::lex::Lex{std::move(iss)}};
+        parse();
+        REQUIRE(ErrCollector::instance().threadErrors().empty());
+        return {parse.backtracks(), tokens.size()};
+    }
+};
+
+#define TEST_CASE_WITH_FIXTURE(...) \
+    TEST_CASE_METHOD(BacktrackTestFixture, __VA_ARGS__)
+
+TEST_CASE_WITH_FIXTURE("Parse: Bounded backtracking", "[Parse]") {
+    auto const once = count(1);
+    auto const twice = count(2);
+    auto const perFunction = twice.backtracks - once.backtracks;
+    auto const tokensPerFunction = twice.tokens - once.tokens;
+
+    // alternatives are picked by their first tokens, backtracking is left
+    // to the few places that need more than a bounded lookahead
+    CAPTURE(perFunction, tokensPerFunction);
+    REQUIRE(perFunction * 2 < tokensPerFunction);
+
+    // and does not depend on the size of the input
+    auto const many = count(1000);
+    REQUIRE(many.backtracks == once.backtracks + 999 * perFunction);
+}
+
+TEST_CASE_WITH_FIXTURE("Parse: Memoized rules", "[Parse]") {
+    auto const malformed = source(3) +
+        "fn g::() -> () {\n"
+        "    ((a, b.c), geo.Point{x: (1, {y: 2})}) + foo();\n"
+        "    ((u, v), w: Int) = ((1, 2), 3);\n"
+        "    (x, = 1;\n"
+        "}\n";
+
+    auto const plain = parse(malformed, false);
+    auto const memoized = parse(malformed, true);
+
+    REQUIRE(plain.memoized == 0);
+    REQUIRE(memoized.memoized > 0);
+    REQUIRE(memoized.astPrint == plain.astPrint);
+    REQUIRE(memoized.errors == plain.errors);
+}
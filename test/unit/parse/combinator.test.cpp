@@ -21,6 +21,19 @@ protected:
         return pc(*m_stream, *m_tracker);
     }
 
+    auto invoke(tlc::parse::combinator::IsCombinator auto const& pc)
+        -> tlc::parse::TokenRangeResult {
+        return pc(*m_stream, *m_tracker);
+    }
+
+    auto spellings(tlc::parse::TokenRange const tokens) -> tlc::Vec<tlc::StrV> {
+        tlc::Vec<tlc::StrV> result;
+        for (auto index = tokens.begin; index < tokens.end; ++index) {
+            result.push_back(m_stream->at(index).str());
+        }
+        return result;
+    }
+
     auto stream() -> tlc::parse::TokenStream {
         REQUIRE(m_stream);
         return *m_stream;
@@ -352,3 +365,81 @@ TEST_CASE_WITH_FIXTURE(
         REQUIRE(result.value().front().lexeme() == identifier);
     }
 }
+
+TEST_CASE_WITH_FIXTURE(
+    "ParserCombinator: Templated combinators", "[Parse][ParserCombinator]"
+) {
+    using namespace tlc::lexeme;
+    namespace pc = tlc::parse::combinator;
+
+    SECTION("Match") {
+        initialize("x=5;");
+
+        auto const result = invoke(pc::match(integer10Literal, identifier));
+        REQUIRE(result);
+        REQUIRE(result->size() == 1);
+        REQUIRE(spellings(*result) == tlc::Vec<tlc::StrV>{"x"});
+        REQUIRE_FALSE(invoke(pc::match(semicolon)));
+        REQUIRE(invoke(pc::match(equal)));
+    }
+
+    SECTION("Many") {
+        initialize("x y z 555 x");
+
+        auto const result = invoke(pc::many0(pc::match(identifier)));
+        REQUIRE(result);
+        REQUIRE(spellings(*result) == tlc::Vec<tlc::StrV>{"x", "y", "z"});
+        REQUIRE(stream().current().str() == "z");
+
+        auto const none = invoke(pc::many0(pc::match(identifier)));
+        REQUIRE(none);
+        REQUIRE(none->empty());
+        REQUIRE_FALSE(invoke(pc::many1(pc::match(identifier))));
+        REQUIRE(invoke(pc::many1(pc::match(integer10Literal)))->size() == 1);
+    }
+
+    SECTION("Any") {
+        initialize("525");
+
+        auto const result = invoke(pc::any(
+            pc::many1(pc::match(identifier)), pc::match(integer10Literal)
+        ));
+        REQUIRE(result);
+        REQUIRE(spellings(*result) == tlc::Vec<tlc::StrV>{"525"});
+    }
+
+    SECTION("Sequence backtracks on failure") {
+        initialize("x = 525;");
+
+        REQUIRE_FALSE(invoke(pc::seq(
+            pc::match(identifier), pc::match(equal), pc::match(identifier)
+        )));
+        REQUIRE(stream().current().str() == "");
+
+        auto const result = invoke(pc::seq(
+            pc::match(identifier), pc::match(equal), pc::match(integer10Literal)
+        ));
+        REQUIRE(result);
+        REQUIRE(spellings(*result) == tlc::Vec<tlc::StrV>{"x", "=", "525"});
+    }
+
+    SECTION("Identifier literals") {
+        constexpr auto parser = pc::seq(
+            pc::many0(pc::seq(pc::match(identifier), pc::match(dot))),
+            pc::match(identifier, fundamentalType, userDefinedType)
+        );
+
+        initialize("foo.bar.Baz");
+
+        auto const result = invoke(parser);
+        REQUIRE(result);
+        REQUIRE(
+            spellings(*result) ==
+            tlc::Vec<tlc::StrV>{"foo", ".", "bar", ".", "Baz"}
+        );
+
+        initialize("foo.");
+        REQUIRE_FALSE(invoke(parser));
+        REQUIRE(stream().current().str() == "");
+    }
+}
@@ -0,0 +1,152 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "parse/parse.hpp"
+
+class IterativeExprTestFixture {
+protected:
+    using ErrCollector = tlc::ErrorCollector<
+        tlc::parse::EParseErrorContext, tlc::parse::EParseErrorReason
+    >;
+
+    static auto parser(tlc::Str source) -> tlc::parse::Parse {
+        std::istringstream iss;
+        iss.str(std::move(source));
+        return tlc::parse::Parse{tlc::lex::Lex::operator()(std::move(iss))};
+    }
+
+    // the printed tree, or an empty string on failure, and the errors
+    // collected along the way
+    static auto print(tlc::Str source, tlc::b8 const recursive)
+        -> tlc::Pair<tlc::Str, tlc::szt> {
+        auto parse = parser(std::move(source));
+        parse.recursiveExpressions(recursive);
+        auto const result = parse.parseExpr();
+        return {
+            result ? tlc::parse::ASTPrinter::operator()(*result) : "",
+            ErrCollector::instance().threadErrors().size()
+        };
+    }
+
+    // number of nested {TNode} along the first children, without recursing
+    template <tlc::syntax::IsStrictlyASTNode TNode>
+    static auto depth(tlc::syntax::Node const& root) -> tlc::szt {
+        tlc::szt result = 0;
+        auto const* node = &root;
+        while (auto const* inner = tlc::syntax::astGetIf<TNode>(*node)) {
+            ++result;
+            node = &inner->firstChild();
+        }
+        return result;
+    }
+};
+
+TEST_CASE_METHOD(
+    IterativeExprTestFixture,
+    "Parse::Expr: Iterative and recursive parsers agree",
+    "[Unit][Parse][Expr]"
+) {
+    auto const source = GENERATE(as<tlc::Str>{},
+        "x",
+        "-x",
+        "- - !x",
+        "a + b * c - d / e",
+        "a ** b ** c |> d || e && f",
+        "a == b != c < d .. e",
+        "-a * ~b + &c",
+        "-f(x, y)[0] + g()(1)[2][3]",
+        "foo.bar(a + b, [c * d, -e])[f - g] * h",
+        "(a + b) * (c, d)",
+        "geo.Point{x: a + b, y: -c} + d",
+        "try f(x) + 1",
+        "\"a{b + c}d\" + e",
+        "a + ",
+        "a * (b + ) - c",
+        "[a, , b] + c",
+        "- )",
+        "[[a, b], [c + , d]] + e",
+        "f(a)(b, [c, (d)])[e](g",
+        "{x: 1, y: {z: [a, b]}}",
+        "geo.Point{x: , y: (a + b) * c}",
+        "try try f(x) * [try y]",
+        "try (a + ) - b",
+        "-[-(-a)] * -(b, -c)"
+    );
+    INFO(source);
+
+    REQUIRE(print(source, false) == print(source, true));
+}
+
+TEST_CASE_METHOD(
+    IterativeExprTestFixture,
+    "Parse::Expr: Nesting depth of 100000",
+    "[Unit][Parse][Expr]"
+) {
+    static constexpr tlc::szt nesting = 100'000;
+
+    SECTION("Binary operators") {
+        tlc::Str source = "x";
+        for (tlc::szt i = 1; i <= nesting; ++i) {
+            source += i % 2 == 0 ? " + x" : " - x";
+        }
+
+        auto parse = parser(std::move(source));
+        auto const result = parse.parseExpr();
+        REQUIRE(result);
+        REQUIRE(ErrCollector::instance().threadEmpty());
+        REQUIRE(depth<tlc::syntax::expr::Binary>(*result) == nesting);
+    }
+
+    SECTION("Prefix operators") {
+        tlc::Str source;
+        for (tlc::szt i = 0; i < nesting; ++i) {
+            source += "- ";
+        }
+        source += "f(x)";
+
+        auto parse = parser(std::move(source));
+        auto const result = parse.parseExpr();
+        REQUIRE(result);
+        REQUIRE(ErrCollector::instance().threadEmpty());
+        REQUIRE(depth<tlc::syntax::expr::Prefix>(*result) == nesting);
+    }
+
+    SECTION("Arrays") {
+        auto source = tlc::Str(nesting, '[') + "x" + tlc::Str(nesting, ']');
+
+        auto parse = parser(std::move(source));
+        auto const result = parse.parseExpr();
+        REQUIRE(result);
+        REQUIRE(ErrCollector::instance().threadEmpty());
+        REQUIRE(depth<tlc::syntax::expr::Array>(*result) == nesting);
+
+        // copies do not recurse once per level either
+        auto const copy = *result;
+        REQUIRE(depth<tlc::syntax::expr::Array>(copy) == nesting);
+
+        // nor do arenas
+        tlc::syntax::Arena const arena{*result};
+        REQUIRE(arena.size() == nesting + 1);
+        REQUIRE(depth<tlc::syntax::expr::Array>(arena.node(arena.root())) == nesting);
+    }
+
+    SECTION("Parentheses") {
+        auto source = tlc::Str(nesting, '(') + "x" + tlc::Str(nesting, ')');
+
+        auto parse = parser(std::move(source));
+        auto const result = parse.parseExpr();
+        REQUIRE(result);
+        REQUIRE(ErrCollector::instance().threadEmpty());
+        REQUIRE(depth<tlc::syntax::expr::Tuple>(*result) == nesting);
+    }
+
+    SECTION("Unclosed arrays") {
+        auto source = tlc::Str(nesting, '[') + "x";
+
+        auto parse = parser(std::move(source));
+        auto const result = parse.parseExpr();
+        REQUIRE(result);
+        REQUIRE(ErrCollector::instance().threadErrors().size() == nesting);
+        REQUIRE(depth<tlc::syntax::expr::Array>(*result) == nesting);
+    }
+}
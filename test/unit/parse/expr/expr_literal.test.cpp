@@ -197,3 +197,32 @@ TEST_CASE_WITH_FIXTURE(
         "false",
     });
 }
+
+TEST_CASE_WITH_FIXTURE(
+    "Parse::Literal: Out of range",
+    "[Unit][Parse][Expr]"
+) {
+    assertExpr({
+        .source =
+        "9223372036854775807",
+
+        .expectedAstPrint =
+        "expr::Integer [@0:0] with value = 9223372036854775807",
+    });
+    assertExpr({
+        .source =
+        "9223372036854775808",
+
+        .expectedErrors = {
+            {.context = Context::NumericLiteral, .reason = Reason::OutOfRange},
+        },
+    });
+    assertExpr({
+        .source =
+        "0x10000000000000000",
+
+        .expectedErrors = {
+            {.context = Context::NumericLiteral, .reason = Reason::OutOfRange},
+        },
+    });
+}
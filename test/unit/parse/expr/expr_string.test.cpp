@@ -51,4 +51,23 @@ TEST_CASE_WITH_FIXTURE(
     });
 }
 
+TEST_CASE_WITH_FIXTURE(
+    "Parse::String: Placeholder spanning lines",
+    "[Unit][Parse][Expr]"
+) {
+    assertExpr({
+        .source =
+        "\"sum: {x +\n  y}!\"",
+
+        .expectedAstPrint =
+        "expr::String [@0:0] with nPlaceholders = 1\n"
+        "├─ expr::Binary [@0:7] with op = '+'\n"
+        "   ├─ expr::Identifier [@0:7] with path = 'x'\n"
+        "   ├─ expr::Identifier [@1:2] with path = 'y'",
+
+        .expectedPrettyPrint =
+        "\"sum: {(x + y)}!\"",
+    });
+}
+
 // todo: errors cases
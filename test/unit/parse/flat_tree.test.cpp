@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "parse/parse.hpp"
+
+class FlatTreeTestFixture {
+protected:
+    using ErrCollector = tlc::ErrorCollector<
+        tlc::parse::EParseErrorContext, tlc::parse::EParseErrorReason
+    >;
+
+    static auto lexer(tlc::Str source) -> tlc::lex::Lex {
+        std::istringstream iss;
+        iss.str(std::move(source));
+        return tlc::lex::Lex{std::move(iss)};
+    }
+
+    // prints both trees and drains the errors collected for each
+    static auto print(tlc::Str const& source) -> tlc::Pair<tlc::Str, tlc::Str> {
+        auto const tree = tlc::parse::Parse::operator()(lexer(source));
+        auto const treeErrors = ErrCollector::instance().threadErrors().size();
+        auto const flat = tlc::parse::Parse::flat(lexer(source));
+        auto const flatErrors = ErrCollector::instance().threadErrors().size();
+        REQUIRE(flatErrors == treeErrors);
+
+        REQUIRE(flat.size() > 0);
+        for (tlc::syntax::NodeId id = 0; id < flat.size(); ++id) {
+            // children precede their parent
+            for (auto const child : flat.children(id)) {
+                REQUIRE(child < id);
+            }
+        }
+        REQUIRE(flat.holds<tlc::syntax::TranslationUnit>(flat.root()));
+
+        return {
+            tlc::parse::ASTPrinter::operator()(tree),
+            tlc::parse::ASTPrinter::operator()(flat, flat.root())
+        };
+    }
+};
+
+#define TEST_CASE_WITH_FIXTURE(...) \
+    TEST_CASE_METHOD(FlatTreeTestFixture, __VA_ARGS__)
+
+TEST_CASE_WITH_FIXTURE("Parse: Flat tree", "[Parse][FlatTree]") {
+    SECTION("Definitions") {
+        auto const [tree, flat] = print(
+            "module flat;\n"
+            "import io;\n"
+            "import geo = lib.geo;\n"
+            "fn f::(a: Int, b: Float) -> (r: Int) {\n"
+            "    y: Int = a + b * 2;\n"
+            "    (u, v: Bool) = (0, 0.0);\n"
+            "    foo.bar(x, [1, 2], geo.Point{x: 1, y: true});\n"
+            "    x == y => return \"a{b}c\";\n"
+            "    for e in r { defer io.println(e); }\n"
+            "    match x { 0 => return 1; _ => {} }\n"
+            "}\n"
+            "pub fn g::() -> () {\n"
+            "    return try f(-1, 2.5);\n"
+            "}\n"
+        );
+        REQUIRE(flat == tree);
+    }
+
+    SECTION("No imports") {
+        auto const [tree, flat] = print("module flat;\nfn f::() -> () {}\n");
+        REQUIRE(flat == tree);
+    }
+
+    SECTION("Missing module declaration") {
+        auto const [tree, flat] = print("fn f::() -> () {}\n");
+        REQUIRE(flat == tree);
+
+        auto const unit = tlc::parse::Parse::flat(lexer("fn f::() -> () {}\n"));
+        auto const errors = ErrCollector::instance().threadErrors();
+        REQUIRE(errors.size() == 1);
+        REQUIRE(errors.front().reason() == tlc::parse::EParseErrorReason::MissingDecl);
+
+        auto const children = unit.children(unit.root());
+        REQUIRE(children.size() == 2);
+        REQUIRE(unit.holds<tlc::syntax::RequiredButMissing>(children[0]));
+        REQUIRE(unit.holds<tlc::syntax::Empty>(children[1]));
+    }
+}
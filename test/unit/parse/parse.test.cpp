@@ -67,7 +67,7 @@ auto ParseTestFixture::parseAndAssert(
     std::istringstream iss;
     iss.str(std::move(params.source));
     auto result = fn(tlc::parse::Parse{
-        filepath, tlc::lex::Lex::operator()(std::move(iss))
+        tlc::lex::Lex::operator()(std::move(iss))
     });
 
     params.expectedAstPrint.transform(
@@ -75,6 +75,13 @@ auto ParseTestFixture::parseAndAssert(
             auto const actualAstPrint =
                 tlc::parse::ASTPrinter::operator()(result);
             REQUIRE(actualAstPrint == expectedAstPrint);
+
+            // the same tree read back from an arena
+            Arena const arena{result};
+            REQUIRE(
+                tlc::parse::ASTPrinter::operator()(arena, arena.root()) ==
+                expectedAstPrint
+            );
             return "";
         }
     );
@@ -84,12 +91,18 @@ auto ParseTestFixture::parseAndAssert(
             auto const actualPrettyPrint =
                 tlc::parse::PrettyPrint::operator()(result);
             REQUIRE(actualPrettyPrint == expectedPrettyPrint);
+
+            Arena const arena{result};
+            REQUIRE(
+                tlc::parse::PrettyPrint::operator()(arena, arena.root()) ==
+                expectedPrettyPrint
+            );
             return "";
         }
     );
 
     auto const actualErrors =
-        ErrCollector::instance().errors();
+        ErrCollector::instance().threadErrors();
     auto const expectedErrors = params.expectedErrors;
     REQUIRE(actualErrors.size() == expectedErrors.size());
     for (auto i : tlc::rv::iota(0ul, actualErrors.size())) {
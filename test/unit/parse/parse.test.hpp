@@ -22,9 +22,6 @@ protected:
     tlc::ErrorCollector<Context, Reason>;
     using SLoc = std::source_location;
 
-    inline static const tlc::fs::path filepath =
-        "toy-lang/test/unit/parse.toy";
-
 protected:
     struct AssertParams {
         tlc::Str source;
@@ -59,10 +56,11 @@ protected:
     ) -> void;
 
 private:
-    template <IsASTNode T>
-    static auto cast(Node const& node) -> T {
-        REQUIRE(matchAstType<T>(node));
-        return astCast<T>(node);
+    template <IsStrictlyASTNode T>
+    static auto cast(Node const& node) -> T const& {
+        auto const* result = astGetIf<T>(node);
+        REQUIRE(result != nullptr);
+        return *result;
     }
 
     static auto parseAndAssert(
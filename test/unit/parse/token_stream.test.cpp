@@ -5,10 +5,156 @@
 
 class TokenStreamTestFixture {
 protected:
-private:
+    static auto lexer(tlc::Str source) -> tlc::lex::Lex {
+        std::istringstream iss;
+        iss.str(std::move(source));
+        return tlc::lex::Lex{std::move(iss)};
+    }
+
+    static auto repeat(tlc::StrV const line, tlc::szt const count) -> tlc::Str {
+        tlc::Str source;
+        source.reserve(line.size() * count);
+        for (tlc::szt i = 0; i < count; ++i) {
+            source += line;
+        }
+        return source;
+    }
 };
 
 #define TEST_CASE_WITH_FIXTURE(...) \
 TEST_CASE_METHOD(TokenStreamTestFixture, __VA_ARGS__)
 
-TEST_CASE_WITH_FIXTURE("TokenStream:", "[Parse][TokenStream]") {}
+TEST_CASE_WITH_FIXTURE("TokenStream: Streamed tokens", "[Parse][TokenStream]") {
+    auto const source = tlc::Str{
+        "let x = foo(1, \"a{b + c}d\"); // comment\nreturn Bar::baz;"
+    };
+    auto tokens = lexer(source)();
+    auto const size = tokens.size();
+    tlc::parse::TokenStream buffered{std::move(tokens)};
+    tlc::parse::TokenStream streamed{lexer(source)};
+
+    tlc::szt count = 0;
+    for (buffered.advance(), streamed.advance(); !buffered.done();
+         buffered.advance(), streamed.advance()) {
+        CAPTURE(count);
+        REQUIRE_FALSE(streamed.done());
+        REQUIRE(streamed.peek().lexeme() == buffered.peek().lexeme());
+        REQUIRE(streamed.current().lexeme() == buffered.current().lexeme());
+        REQUIRE(streamed.current().str() == buffered.current().str());
+        REQUIRE(streamed.current().symbol() == buffered.current().symbol());
+        REQUIRE(
+            streamed.current().location().offset ==
+            buffered.current().location().offset
+        );
+        ++count;
+    }
+
+    REQUIRE(streamed.done());
+    REQUIRE(count == size);
+}
+
+TEST_CASE_WITH_FIXTURE("TokenStream: Bounded window", "[Parse][TokenStream]") {
+    tlc::parse::TokenStream stream{lexer(repeat("let x = y;\n", 20000))};
+    auto const initialWindowSize = stream.windowSize();
+
+    tlc::szt count = 0;
+    for (stream.advance(); !stream.done(); stream.advance()) {
+        ++count;
+    }
+
+    REQUIRE(count == 100000);
+    REQUIRE(stream.windowSize() == initialWindowSize);
+}
+
+TEST_CASE_WITH_FIXTURE("TokenStream: Backtrack pins the window", "[Parse][TokenStream]") {
+    tlc::parse::TokenStream stream{lexer(repeat("foo Bar 1 ;\n", 5000))};
+    auto const initialWindowSize = stream.windowSize();
+
+    for (tlc::szt i = 0; i < 10; ++i) {
+        stream.advance();
+    }
+    auto const marked = stream.current().location().offset;
+
+    {
+        auto backtrack = stream.scopedBacktrack();
+        for (tlc::szt i = 0; i < 1000; ++i) {
+            stream.advance();
+        }
+        REQUIRE(stream.windowSize() >= 1000);
+        backtrack();
+    }
+
+    REQUIRE(stream.current().location().offset == marked);
+
+    {
+        // a released mark no longer pins anything
+        auto backtrack = stream.scopedBacktrack();
+        stream.advance();
+    }
+
+    auto const pinnedWindowSize = stream.windowSize();
+    tlc::szt count = 10;
+    for (; !stream.done(); stream.advance()) {
+        ++count;
+    }
+
+    REQUIRE(count == 20000);
+    REQUIRE(pinnedWindowSize > initialWindowSize);
+    REQUIRE(stream.windowSize() == pinnedWindowSize);
+}
+
+TEST_CASE_WITH_FIXTURE("TokenStream: Views", "[Parse][TokenStream]") {
+    auto const source = tlc::Str{"let identifierLongerThanSmallStrings = \"fragment\";"};
+    tlc::parse::TokenStream buffered{lexer(source)()};
+    tlc::parse::TokenStream streamed{lexer(source)};
+
+    for (auto* stream : {&buffered, &streamed}) {
+        REQUIRE(stream->current().lexeme() == tlc::lexeme::invalid);
+        REQUIRE(stream->current().str().empty());
+
+        stream->advance();
+        // views share the spelling of the token instead of copying it
+        REQUIRE(stream->peek().str() == "identifierLongerThanSmallStrings");
+        REQUIRE(stream->peek().str().data() == stream->peek().str().data());
+        stream->advance();
+        REQUIRE(stream->current().str().data() == stream->current().str().data());
+
+        while (!stream->done()) {
+            stream->advance();
+        }
+        REQUIRE(stream->peek().lexeme() == tlc::lexeme::invalid);
+        REQUIRE(stream->current().lexeme() == tlc::lexeme::invalid);
+        REQUIRE(
+            stream->peek().location().offset ==
+            tlc::parse::TokenStream::invalidToken.location().offset
+        );
+    }
+}
+
+TEST_CASE_WITH_FIXTURE("TokenStream: Views across a window grow", "[Parse][TokenStream]") {
+    tlc::parse::TokenStream stream{lexer(
+        "\"escaped\\tfragment that does not fit a small string\" short " +
+        repeat("foo Bar 1 ;\n", 1000)
+    )};
+    auto const initialWindowSize = stream.windowSize();
+
+    auto backtrack = stream.scopedBacktrack();
+    stream.advance();
+    auto const fragment = stream.current();
+    stream.advance();
+    auto const name = stream.current();
+    REQUIRE(fragment.str() == "escaped\tfragment that does not fit a small string");
+    REQUIRE(name.str() == "short");
+
+    // the mark pins both tokens while the window grows around them
+    for (tlc::szt i = 0; i < 1000; ++i) {
+        stream.advance();
+    }
+    REQUIRE(stream.windowSize() > initialWindowSize);
+    REQUIRE(fragment.str() == "escaped\tfragment that does not fit a small string");
+    REQUIRE(name.str() == "short");
+
+    backtrack();
+    stream.advance();
+    REQUIRE(stream.current().str().data() == fragment.str().data());
+}
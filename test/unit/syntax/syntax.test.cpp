@@ -4,6 +4,10 @@
 
 class SyntaxTestFixture {
 protected:
+    static auto symbol(tlc::StrV const str) -> tlc::Symbol {
+        return tlc::Interner::instance().intern(str);
+    }
+
 private:
 };
 
@@ -11,3 +15,96 @@ private:
     TEST_CASE_METHOD(SyntaxTestFixture, __VA_ARGS__)
 
 TEST_CASE_WITH_FIXTURE("Syntax: ", "[Syntax]") {}
+
+TEST_CASE_WITH_FIXTURE("Syntax: Non-copying accessors", "[Syntax]") {
+    using namespace tlc::syntax;
+
+    SECTION("astGetIf") {
+        Node node = expr::Binary{
+            expr::Integer{1, {}}, expr::Identifier{{symbol("x")}, {}},
+            tlc::lexeme::plus, {}
+        };
+        Node const& constNode = node;
+
+        auto const* binary = astGetIf<expr::Binary>(constNode);
+        REQUIRE(binary == &std::get<expr::Binary>(node));
+        REQUIRE(astGetIf<expr::Binary>(node) == &std::get<expr::Binary>(node));
+        REQUIRE(astGetIf<expr::Prefix>(constNode) == nullptr);
+        REQUIRE(astGetIf<expr::Integer>(Node{}) == nullptr);
+
+        auto const* lhs = astGetIf<expr::Integer>(binary->firstChild());
+        REQUIRE(lhs != nullptr);
+        REQUIRE(lhs->value() == 1);
+        REQUIRE(astGetIf<expr::Identifier>(binary->lastChild())->path() == "x");
+    }
+
+    SECTION("Children by reference") {
+        Node const infer = type::Infer{expr::Integer{2, {}}, {}};
+        auto const& inferNode = *astGetIf<type::Infer>(infer);
+        REQUIRE(&inferNode.expr() == &inferNode.firstChild());
+
+        Node const tuple = decl::Tuple{
+            {
+                decl::Identifier{symbol("a"), {}, {}},
+                decl::Identifier{symbol("b"), {}, {}},
+            },
+            {}
+        };
+        auto const& tupleNode = *astGetIf<decl::Tuple>(tuple);
+        REQUIRE(&tupleNode.decl(1) == &tupleNode.children()[1]);
+        REQUIRE(astGetIf<decl::Identifier>(tupleNode.decl(1))->name() == "b");
+    }
+}
+
+TEST_CASE_WITH_FIXTURE("Syntax: Arena layout", "[Syntax][Arena]") {
+    using namespace tlc::syntax;
+
+    // -(1 + x)
+    Node const tree = expr::Prefix{
+        expr::Binary{
+            expr::Integer{1, {}}, expr::Identifier{{symbol("x")}, {}},
+            tlc::lexeme::plus, {}
+        },
+        tlc::lexeme::minus, {}
+    };
+    Arena const flat{tree};
+
+    REQUIRE(flat.size() == 4);
+    REQUIRE(flat.root() == 3);
+
+    // post-order
+    REQUIRE(flat.holds<expr::Integer>(0));
+    REQUIRE(flat.holds<expr::Identifier>(1));
+    REQUIRE(flat.holds<expr::Binary>(2));
+    REQUIRE(flat.holds<expr::Prefix>(3));
+    REQUIRE(flat.kinds()[2] == nodeIndex<expr::Binary>);
+    REQUIRE(tlc::rng::equal(flat.children(2), tlc::Vec<NodeId>{0, 1}));
+    REQUIRE(tlc::rng::equal(flat.children(3), tlc::Vec<NodeId>{2}));
+    REQUIRE(flat.children(0).empty());
+
+    REQUIRE(flat.payloads().integer(flat.payload(0)) == 1);
+    REQUIRE(flat.payloads().segments(flat.payload(1)).front() == symbol("x"));
+    REQUIRE(flat.payload(2).op == tlc::lexeme::plus);
+    REQUIRE(flat.payload(3).op == tlc::lexeme::minus);
+
+    auto const materialized = flat.node(flat.root());
+    auto const* prefix = astGetIf<expr::Prefix>(materialized);
+    REQUIRE(prefix != nullptr);
+    REQUIRE(prefix->op() == tlc::lexeme::minus);
+    REQUIRE(astGetIf<expr::Binary>(prefix->firstChild())->op() == tlc::lexeme::plus);
+
+    // visits read the nodes in place, children first
+    tlc::Vec<tlc::szt> visited;
+    tlc::i64 integers = 0;
+    flat.visit([&]<typename T>(ArenaNode<T> const node) {
+        visited.push_back(nodeIndex<T>);
+        if constexpr (std::same_as<T, expr::Integer>) {
+            integers += node.arena().payloads().integer(node.payload());
+        }
+    });
+    REQUIRE(tlc::rng::equal(visited, flat.kinds()));
+    REQUIRE(integers == 1);
+    REQUIRE(flat.visit(2, []<typename T>(ArenaNode<T> const node) {
+        return node.children().size();
+    }) == 2);
+}
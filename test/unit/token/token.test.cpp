@@ -11,3 +11,55 @@ private:
     TEST_CASE_METHOD(TokenTestFixture, __VA_ARGS__)
 
 TEST_CASE_WITH_FIXTURE("Token: ", "[Token]") {}
+
+TEST_CASE_WITH_FIXTURE("Token: Lexemes are compile-time constants", "[Token]") {
+    using namespace tlc::lexeme;
+
+    STATIC_REQUIRE(sizeof(Lexeme) == 1);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<Lexeme>);
+    STATIC_REQUIRE(module_.str() == "module");
+    STATIC_REQUIRE(star2Equal.str() == "**=");
+    STATIC_REQUIRE(anonymous.str() == "_");
+    STATIC_REQUIRE(identifier.str().empty());
+    STATIC_REQUIRE(Lexeme{Lexeme::Dot3} == dot3);
+}
+
+TEST_CASE_WITH_FIXTURE("Token: Reserved names", "[Token]") {
+    using namespace tlc::lexeme;
+
+    for (auto const& [type, str] : keywordSpellings) {
+        REQUIRE(reservedName(str) == Lexeme{type});
+    }
+    for (auto const str : fundamentalTypeSpellings) {
+        REQUIRE(reservedName(str) == fundamentalType);
+    }
+
+    STATIC_REQUIRE(reservedName("type") == type);
+    STATIC_REQUIRE(reservedName("true") == true_);
+    STATIC_REQUIRE(reservedName("String") == fundamentalType);
+    STATIC_REQUIRE(reservedName("string") == empty);
+    STATIC_REQUIRE(reservedName("types") == empty);
+    STATIC_REQUIRE(reservedName("Point") == empty);
+    STATIC_REQUIRE(reservedName("") == empty);
+}
+
+TEST_CASE_WITH_FIXTURE("Token: Symbol automaton", "[Token]") {
+    using namespace tlc::lexeme;
+    using Match = tlc::Pair<Lexeme, tlc::szt>;
+
+    for (auto const& [type, str] : symbolSpellings) {
+        if (isLexedSymbol(type)) {
+            REQUIRE(symbolAutomaton.longestMatch(str) == Match{Lexeme{type}, str.size()});
+        }
+    }
+
+    STATIC_REQUIRE(symbolAutomaton.longestMatch(">>=1") == Match{greater2Equal, 3});
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("|>x") == Match{barGreater, 2});
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("....") == Match{dot3, 3});
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("..x") == Match{dot2, 2});
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("__") == Match{anonymous, 1});
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("!!") == Match{exclaim, 1});
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("<-") == Match{less, 1});
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("`").second == 0);
+    STATIC_REQUIRE(symbolAutomaton.longestMatch("").second == 0);
+}
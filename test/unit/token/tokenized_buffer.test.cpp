@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "token/token.hpp"
+
+class TokenizedBufferTestFixture {
+protected:
+    auto initialize(tlc::Str source) -> void {
+        m_tokens = tlc::token::TokenizedBuffer{
+            tlc::SourceManager::instance().add(
+                std::make_shared<tlc::SourceBuffer const>(std::move(source))
+            )
+        };
+    }
+
+    auto push(
+        tlc::lexeme::Lexeme const lexeme, tlc::szt const offset,
+        tlc::szt const length, tlc::StrV const spelling
+    ) -> tlc::token::TokenIndex {
+        return m_tokens.push(lexeme, offset, length, spelling);
+    }
+
+    [[nodiscard]] auto tokens() const -> tlc::token::TokenizedBuffer const& {
+        return m_tokens;
+    }
+
+private:
+    tlc::token::TokenizedBuffer m_tokens;
+};
+
+#define TEST_CASE_WITH_FIXTURE(...) \
+    TEST_CASE_METHOD(TokenizedBufferTestFixture, __VA_ARGS__)
+
+TEST_CASE_WITH_FIXTURE("TokenizedBuffer: Tokens spelled by the source", "[Token][TokenizedBuffer]") {
+    using namespace tlc::lexeme;
+
+    initialize("let x = 0x1f;");
+    REQUIRE(push(let, 0, 3, "let") == 0);
+    REQUIRE(push(identifier, 4, 1, "x") == 1);
+    REQUIRE(push(equal, 6, 1, "=") == 2);
+    REQUIRE(push(integer16Literal, 8, 4, "0x1f") == 3);
+    REQUIRE(push(semicolon, 12, 1, ";") == 4);
+
+    REQUIRE(tokens().size() == 5);
+    REQUIRE(tokens().kind(0) == Lexeme::Let);
+    REQUIRE(tokens().lexeme(0) == let);
+    REQUIRE(tokens().lexeme(0).str() == "let");
+    REQUIRE(tokens().lexeme(2).str() == "=");
+    REQUIRE(tokens().str(1) == "x");
+    REQUIRE(tokens().str(3) == "0x1f");
+    REQUIRE(tokens().offset(3) == 8);
+    REQUIRE(tokens().length(3) == 4);
+    REQUIRE(tokens().location(4).offset == 12);
+    REQUIRE(tokens().location(4).file == tokens().file());
+
+    auto const token = tokens()[3];
+    REQUIRE(token.lexeme() == integer16Literal);
+    REQUIRE(token.str() == "0x1f");
+    REQUIRE(token.column() == 8);
+}
+
+TEST_CASE_WITH_FIXTURE("TokenizedBuffer: Decoded strings", "[Token][TokenizedBuffer]") {
+    using namespace tlc::lexeme;
+
+    initialize(R"("a\tb{x}c")");
+    push(stringFragment, 0, 6, "a\tb");
+    push(placeholderBegin, 5, 1, "{");
+    push(identifier, 6, 1, "x");
+    push(placeholderEnd, 7, 1, "}");
+    push(stringFragment, 8, 2, "c");
+
+    REQUIRE(tokens().str(0) == "a\tb");
+    REQUIRE(tokens().str(1) == "{");
+    REQUIRE(tokens().str(2) == "x");
+    REQUIRE(tokens().str(3) == "}");
+    REQUIRE(tokens().str(4) == "c");
+    REQUIRE(tokens().offset(0) == 0);
+    REQUIRE(tokens().length(0) == 6);
+}
+
+TEST_CASE_WITH_FIXTURE("TokenizedBuffer: Strings spelled by the source", "[Token][TokenizedBuffer]") {
+    using namespace tlc::lexeme;
+
+    initialize(R"("ab{x}c" "")");
+    push(stringFragment, 0, 4, "ab");
+    push(placeholderBegin, 3, 1, "{");
+    push(identifier, 4, 1, "x");
+    push(placeholderEnd, 5, 1, "}");
+    push(stringFragment, 6, 2, "c");
+    push(stringFragment, 9, 2, "");
+
+    auto const source = tlc::SourceManager::instance().buffer(tokens().file())->view();
+    REQUIRE(tokens().str(0) == "ab");
+    REQUIRE(tokens().str(0).data() == source.data() + 1);
+    REQUIRE(tokens().str(4) == "c");
+    REQUIRE(tokens().str(4).data() == source.data() + 6);
+    REQUIRE(tokens().str(5).empty());
+    REQUIRE(tokens().length(0) == 4);
+}
+
+TEST_CASE_WITH_FIXTURE("TokenizedBuffer: Interned names", "[Token][TokenizedBuffer]") {
+    using namespace tlc::lexeme;
+
+    initialize("let x: i32 = x;");
+    push(let, 0, 3, "let");
+    push(identifier, 4, 1, "x");
+    push(colon, 5, 1, ":");
+    push(fundamentalType, 7, 3, "i32");
+    push(equal, 11, 1, "=");
+    push(identifier, 13, 1, "x");
+
+    REQUIRE(tokens().symbol(0).empty());
+    REQUIRE(tokens().symbol(1).str() == "x");
+    REQUIRE(tokens().symbol(3).str() == "i32");
+    REQUIRE(tokens().symbol(1) == tokens().symbol(5));
+    REQUIRE(tokens()[5].symbol() == tlc::Interner::instance().intern("x"));
+}